@@ -1,398 +1,467 @@
-#include <unordered_map>
-
-#include "Globals.h"
-#include "DetKDecomp.h"
-#include "BalKDecomp.h"
-#include "Hypergraph.h"
-#include "Hyperedge.h"
-#include "Superedge.h"
-#include "Hypertree.h"
-#include "CombinationIterator.h"
-#include "Subedges.h"
-#include "SubedgeSeparatorFactory.h"
-
-
-int BalKDecomp::MyMaxRecursion{ 0 };
-HypergraphSharedPtr BalKDecomp::MyBaseGraph{ nullptr };
-list<HypergraphSharedPtr> BalKDecomp::sFailedHg;
-unordered_map<HypergraphSharedPtr, HypertreeSharedPtr> BalKDecomp::sSuccHg;
-
-HypertreeSharedPtr BalKDecomp::decomp(const HyperedgeVector &Edges)
-{
-	int nbr_parts;
-	list<SeparatorSharedPtr> bal_seps;
-	unordered_set<SuperedgeSharedPtr> checked;
-	vector<DecompComponent> partitions;
-	HypertreeSharedPtr htree;
-	SeparatorSharedPtr sep;
-	int *indices;
-	HyperedgeVector sep_edges; //Edges to consider for the separator
-	SuperedgeSharedPtr sep_edge;
-	VertexSet vertices;
-	int cnt_bal{ 0 }, cnt_sub_bal{ 0 };
-
-	if ((htree = decompTrivial(Edges, VertexSet())) != nullptr)
-		return htree;
-
-	// reset all labels
-	MyBaseGraph->setAllLabels();
-	MyHg->setAllLabels();
-
-	sep_edges = getNeighborEdges(Edges);
-
-	CombinationIterator comb(sep_edges.size(), MyK);
-	comb.setStage(MyK);
-
-	for (auto he : Edges)
-		for (auto v : he->allVertices())
-			vertices.insert(v);
-
-	//cout << "Decomposing: " << vertices << endl;
-
-	// Find balanced separators
-	while ((indices = comb.next()) != nullptr && htree == nullptr) {
-		MyHg->setAllLabels();
-
-		sep = make_shared<Separator>();
-
-		for (int i = 0; i < MyK; i++) {
-			auto he = sep_edges[indices[i]];
-			he->setAllLabels(-1);
-			sep->push_back(he);
-		}
-
-		nbr_parts = separate(sep,Edges,partitions);
-
-		if (isBalanced(partitions, Edges.size())) {
-			sep_edge = Superedge::getSuperedge(sep->edges(), vertices);
-			// super edge must be new and
-			// super edge from separator must not be part of current component
-			if (checked.find(sep_edge) == checked.end() &&
-				(MyHg->getNbrOfSuperEdges() == 0 || find(Edges.begin(), Edges.end(), sep_edge) == Edges.end())) {
-
-				checked.insert(sep_edge);
-
-				cnt_bal++;
-				//Now try to decompose 
-				list<HypertreeSharedPtr> subtrees = decompose(sep, sep_edge, partitions);
-
-				if (subtrees.size() > 0) {
-					for (auto e : sep->allEdges())
-						e->setAllLabels(-1);
-
-					htree = getHTNode(Edges, sep, VertexSet(), subtrees, sep_edge);
-				}
-				else {
-					bal_seps.push_back(sep);
-				}
-			}
-		}
-
-		partitions.clear();
-	}
-
-	if (MyRecLevel == 0)
-		cout << cnt_bal << " balanced separators tried." << endl;
-
-	// Now we are trying subedge separators
-	if (htree == nullptr) {
-
-		// All separators failed, try subedge separators
-		while (!bal_seps.empty() && htree == nullptr) {
-			SubedgeSeparatorFactory sub_sep_fac;
-			
-			sep = bal_seps.back();
-			bal_seps.pop_back();
-
-			sub_sep_fac.init(MyHg, Edges, sep, MySubedges);
-
-			do {
-				MyHg->setAllLabels();
-
-				for (auto he : sep->allEdges())
-					he->setAllLabels(-1);
-
-				sep_edge = Superedge::getSuperedge(sep->edges(), vertices);
-
-				// super edge must be new and
-				// super edge from separator must not be part of current component
-				if (checked.find(sep_edge) == checked.end() &&
-					(MyHg->getNbrOfSuperEdges() == 0 || find(Edges.begin(), Edges.end(), sep_edge) == Edges.end())) {
-
-					checked.insert(sep_edge);
-
-					nbr_parts = separate(sep,Edges, partitions);
-
-					if (isBalanced(partitions, Edges.size())) {
-
-
-						//Now try to decompose 
-						list<HypertreeSharedPtr> subtrees = decompose(sep, sep_edge, partitions);
-
-						if (subtrees.size() > 0) {
-							for (auto e : sep->allEdges())
-								e->setAllLabels(-1);
-
-							/*
-							for (int i = 0; i < MyRecLevel; i++)
-							cout << "+";
-							cout << " " << *Sep << ": " << *Sup  << endl;
-							*/
-
-							htree = getHTNode(Edges, sep, VertexSet(), subtrees, sep_edge);
-						}
-
-						cnt_sub_bal++;
-					}
-
-					partitions.clear();
-				}
-
-
-			} while (htree == nullptr && (sep = sub_sep_fac.next())->size() != 0);
-		}
-	}
-
-	//if (htree != nullptr)
-	//	htree->reduceChi(&vertices);
-
-	if (MyRecLevel == 0)
-		cout << cnt_sub_bal << " subedge balanced separators tried." << endl;
-
-	return htree;
-}
-
-list<HypertreeSharedPtr> BalKDecomp::decompose(const SeparatorSharedPtr &Sep, const SuperedgeSharedPtr &Sup, const vector<DecompComponent> &Parts)
-{
-	HypergraphSharedPtr hypergraph;
-	unique_ptr<BalKDecomp> baldecomp;
-	HypertreeSharedPtr htree{ nullptr };
-	list<HypertreeSharedPtr> subtrees;
-	vector<HypergraphSharedPtr> hypergraphs;
-	vector<bool> v_succ;
-	bool succ;
-	bool failed = false;
-
-	for (auto part : Parts) {
-		failed = getHypergraph<HyperedgeVector>(hypergraph, succ, part.component(), Sup);
-		v_succ.push_back(succ);
-
-		if (failed)
-			break;
-		else
-			hypergraphs.push_back(hypergraph);
-	}
-
-	if (!failed) {
-		int i = 0;
-		for (auto hg : hypergraphs) {
-			//hypergraph has been succesfully decomposed previously
-			if (v_succ[i]) {
-				htree = sSuccHg[hg]->clone();
-				subtrees.push_back(htree);
-			}
-			else {
-				baldecomp = make_unique<BalKDecomp>(hg, MyK, MyRecLevel + 1);
-				htree = baldecomp->buildHypertree();
-
-				if (htree == nullptr) {
-					sFailedHg.push_back(hg);
-					break;
-				}
-				else {
-					sSuccHg[hg] = htree->clone();
-					subtrees.push_back(htree);
-				}
-			}
-			i++;
-		}
-	}
-
-	if (htree == nullptr)
-		subtrees.clear();
-
-
-	return subtrees;
-}
-
-HyperedgeVector BalKDecomp::getNeighborEdges(const HyperedgeVector &Edges) const
-{
-	HyperedgeVector neighbors;
-
-	for (auto he : Edges) {
-		if (!he->isHeavy())
-			neighbors.push_back(he);
-		for (auto v : he->allVertices())
-			for (auto n : MyBaseGraph->allVertexNeighbors(v))
-				if (find(neighbors.begin(),neighbors.end(),n) == neighbors.end())
-					neighbors.push_back(n);
-	}
-
-	return neighbors;
-}
-
-bool BalKDecomp::isBalanced(const vector<DecompComponent>& Parts, int CompSize)
-{
-	if (Parts.size() > 1) {
-		for (auto p : Parts)
-			if (p.size() > CompSize / 2)
-				return false;
-
-		return true;
-	}
-
-	return false;
-}
-
-BalKDecomp::BalKDecomp(const HypergraphSharedPtr &HGraph, int k, int RecLevel) : Decomp(HGraph, k), MyRecLevel{ RecLevel }
-{
-	MySubedges = make_unique<Subedges>(HGraph, k);
-}
-
-BalKDecomp::~BalKDecomp()
-{
-}
-
-template<typename T>
-bool BalKDecomp::getHypergraph(HypergraphSharedPtr &Hg, bool &Succ, const T &Part, const SuperedgeSharedPtr &Sup) const
-{
-	size_t cnt = Part.size() + (Sup != nullptr ? 1 : 0);
-
-	for (auto hg : sFailedHg) {
-		bool found = true;
-
-		if (hg->getNbrOfEdges() == cnt) {
-			if (Sup != nullptr && !hg->hasEdge(Sup))
-				found = false;
-			if (found && !hg->hasAllEdges(Part))
-				found = false;
-		}
-		else
-			found = false;
-
-		if (found) {
-			Hg = hg;
-			return true;
-		}
-	}
-
-	for (auto pair : sSuccHg) {
-		HypergraphSharedPtr hg = pair.first;
-		bool found = true;
-
-		if (hg->getNbrOfEdges() == cnt) {
-			if (Sup != nullptr && !hg->hasEdge(Sup))
-				found = false;
-			if (found && !hg->hasAllEdges(Part))
-				found = false;
-		}
-		else
-			found = false;
-
-		if (found) {
-			Hg = hg;
-			Succ = true;
-			return false;
-		}
-	}
-
-
-	Hg = make_shared<Hypergraph>();
-	Hg->setParent(MyBaseGraph);
-
-	for (auto he : Part)
-		Hg->insertEdge(he);
-	if (Sup != nullptr)
-		Hg->insertEdge(Sup);
-	Succ = false;
-	return false;
-}
-
-/*
-***Description***
-The method expands pruned hypertree nodes, i.e., subgraphs which were not decomposed but are
-known to be decomposable are decomposed.
-
-INPUT:	HTree: Hypertree that has to be expanded
-OUTPUT: HTree: Expanded hypertree
-*/
-
-void BalKDecomp::expandHTree(const HypertreeSharedPtr &HTree)
-{
-	HypertreeSharedPtr cut_node;
-	HypertreeSharedPtr subtree;
-	HyperedgeSet lambda;
-	HypergraphSharedPtr hg;
-	bool succ;
-	unique_ptr<BalKDecomp> baldecomp;
-	//set<Hyperedge *>::iterator SetIter1;
-	//set<Node *>::iterator SetIter2;
-
-	/*
-	ParentSep = new Hyperedge*[iMyK+1];
-	if(ParentSep == NULL)
-	writeErrorMsg("Error assigning memory.", "DetKDecomp::expandHTree");
-	*/
-
-	while ((cut_node = HTree->getCutNode()) != nullptr) {
-		// Store subgraph in an array
-		lambda = cut_node->getLambda();
-
-		// Get subgraph
-		getHypergraph<HyperedgeSet>(hg, succ, lambda);
-
-		if (!succ)
-			writeErrorMsg("Hypergraph was not successfully decomposed!", "BalKDecomp::expandHTree");
-		
-		// Decompose subgraph
-		baldecomp = make_unique<BalKDecomp>(hg, MyK, cut_node->getLabel());
-		subtree = baldecomp->buildHypertree();
-		baldecomp = nullptr;
-
-		
-		if (subtree == nullptr)
-			writeErrorMsg("Illegal decomposition pruning.", "BalKDecomp::expandHTree");
-
-		
-		HypertreeSharedPtr parent = cut_node->getParent().lock();
-
-		// Replace the pruned node by the corresponding subtree
-		parent->insChild(subtree);
-		parent->remChild(cut_node);
-
-	}
-}
-
-HypertreeSharedPtr BalKDecomp::buildHypertree()
-{
-	HypertreeSharedPtr HTree;
-	
-	if (MyMaxRecursion == 0 || MyRecLevel < MyMaxRecursion) {
-		HyperedgeVector HEdges;
-
-		// Order hyperedges heuristically
-		HEdges = MyHg->getMCSOrder();
-
-		// Store initial heuristic order as weight
-		//for (int i = 0; i < HEdges.size(); i++)
-		//	HEdges[i]->setWeight(i);
-
-
-		// Build hypertree decomposition
-		HTree = decomp(HEdges);
-	}
-	else {
-		// Use normal DetKDecomp
-		DetKDecomp Decomp(MyHg, MyK, true);
-
-		HTree = Decomp.buildHypertree();
-	}
-
-	if (MyRecLevel == 0 && HTree != nullptr && HTree->getCutNode() != nullptr) {
-		cout << "Expanding hypertree ..." << endl;
-		expandHTree(HTree);
-	}
-
-
-	return HTree;
-}
+#include <unordered_map>
+
+#include "Globals.h"
+#include "DetKDecomp.h"
+#include "BalKDecomp.h"
+#include "Hypergraph.h"
+#include "Hyperedge.h"
+#include "Superedge.h"
+#include "Hypertree.h"
+#include "CombinationIterator.h"
+#include "Subedges.h"
+#include "SubedgeSeparatorFactory.h"
+#include "SearchStats.h"
+#include "SearchTrace.h"
+
+
+int BalKDecomp::MyMaxRecursion{ 0 };
+HypergraphSharedPtr BalKDecomp::MyBaseGraph{ nullptr };
+list<BalKDecomp::CachedHg> BalKDecomp::sCachedHg;
+size_t BalKDecomp::sCacheBytes{ 0 };
+size_t BalKDecomp::sCacheLimit{ 0 };
+
+// Estimates the memory of a hypergraph resp. a hypertree in bytes
+static size_t hypergraphBytes(const Hypergraph &Hg)
+{
+	return sizeof(Hypergraph) + (Hg.getNbrOfEdges() + Hg.getNbrOfVertices()) * 4 * sizeof(void *);
+}
+
+static size_t hypertreeBytes(const Hypertree &HTree)
+{
+	size_t bytes = sizeof(Hypertree) + (HTree.getChi().size() + HTree.getLambda().size()) * 3 * sizeof(void *);
+
+	for (auto &child : HTree.allChildren())
+		bytes += hypertreeBytes(*child) + 3 * sizeof(void *);
+
+	return bytes;
+}
+
+HypertreeSharedPtr BalKDecomp::decomp(const HyperedgeVector &Edges)
+{
+	int nbr_parts;
+	list<SeparatorSharedPtr> bal_seps;
+	unordered_set<SuperedgeSharedPtr> checked;
+	vector<DecompComponent> partitions;
+	HypertreeSharedPtr htree;
+	SeparatorSharedPtr sep;
+	int *indices;
+	HyperedgeVector sep_edges; //Edges to consider for the separator
+	SuperedgeSharedPtr sep_edge;
+	VertexSet vertices;
+	int cnt_bal{ 0 }, cnt_sub_bal{ 0 };
+
+	SearchTrace::Scope trace(MyRecLevel, Edges.size());
+	if ((htree = decompTrivial(Edges, VertexSet())) != nullptr) {
+		trace.setResult(true);
+		return htree;
+	}
+
+	sep_edges = getNeighborEdges(Edges);
+
+	CombinationIterator comb(sep_edges.size(), MyK);
+	comb.setStage(MyK);
+
+	for (auto he : Edges)
+		for (auto v : he->allVertices())
+			vertices.insert(v);
+
+	//cout << "Decomposing: " << vertices << endl;
+
+	// Find balanced separators
+	while (htree == nullptr && (indices = comb.next()) != nullptr && trySeparator()) {
+		sep = make_shared<Separator>(MyHg->core());
+
+		for (int i = 0; i < MyK; i++)
+			sep->push_back(sep_edges[indices[i]]);
+		SearchTrace::Scope sep_trace(MyRecLevel, sep->signature());
+
+		nbr_parts = separate(sep,Edges,partitions);
+		SearchTrace::event(SearchTrace::Kind::Split, MyRecLevel, nbr_parts);
+
+		if (!isBalanced(partitions, Edges.size()))
+			SearchStats::count(SearchStats::Counter::SepsPruned);
+		else {
+			sep_edge = Superedge::getSuperedge(sep->edges(), vertices);
+			// super edge must be new and
+			// super edge from separator must not be part of current component
+			if (checked.find(sep_edge) == checked.end() &&
+				(MyHg->getNbrOfSuperEdges() == 0 || find(Edges.begin(), Edges.end(), sep_edge) == Edges.end())) {
+
+				checked.insert(sep_edge);
+
+				cnt_bal++;
+				//Now try to decompose 
+				list<HypertreeSharedPtr> subtrees = decompose(sep, sep_edge, partitions);
+
+				if (subtrees.size() > 0 && (htree = getHTNode(Edges, sep, VertexSet(), subtrees, sep_edge)) != nullptr)
+					sep_trace.setResult(true);
+				else {
+					bal_seps.push_back(sep);
+				}
+			}
+		}
+
+		partitions.clear();
+	}
+
+	if (MyRecLevel == 0)
+		*MyLog << cnt_bal << " balanced separators tried." << endl;
+
+	// Now we are trying subedge separators
+	if (htree == nullptr) {
+
+		// All separators failed, try subedge separators
+		while (!bal_seps.empty() && htree == nullptr && !interrupted()) {
+			SubedgeSeparatorFactory sub_sep_fac;
+			
+			sep = bal_seps.back();
+			bal_seps.pop_back();
+
+			sub_sep_fac.init(MyContext, Edges, sep, MySubedges);
+
+			do {
+				sep_edge = Superedge::getSuperedge(sep->edges(), vertices);
+
+				// super edge must be new and
+				// super edge from separator must not be part of current component
+				if (checked.find(sep_edge) == checked.end() &&
+					(MyHg->getNbrOfSuperEdges() == 0 || find(Edges.begin(), Edges.end(), sep_edge) == Edges.end())) {
+
+					checked.insert(sep_edge);
+					SearchTrace::Scope sep_trace(MyRecLevel, sep->signature());
+
+					nbr_parts = separate(sep,Edges, partitions);
+					SearchTrace::event(SearchTrace::Kind::Split, MyRecLevel, nbr_parts);
+
+					if (!isBalanced(partitions, Edges.size()))
+						SearchStats::count(SearchStats::Counter::SepsPruned);
+					else {
+
+
+						//Now try to decompose 
+						list<HypertreeSharedPtr> subtrees = decompose(sep, sep_edge, partitions);
+
+						if (subtrees.size() > 0) {
+							/*
+							for (int i = 0; i < MyRecLevel; i++)
+							cout << "+";
+							cout << " " << *Sep << ": " << *Sup  << endl;
+							*/
+
+							if ((htree = getHTNode(Edges, sep, VertexSet(), subtrees, sep_edge)) != nullptr)
+								sep_trace.setResult(true);
+						}
+
+						cnt_sub_bal++;
+					}
+
+					partitions.clear();
+				}
+
+
+			} while (htree == nullptr && (sep = sub_sep_fac.next())->size() != 0 && trySeparator());
+		}
+	}
+
+	//if (htree != nullptr)
+	//	htree->reduceChi(&vertices);
+
+	if (MyRecLevel == 0)
+		*MyLog << cnt_sub_bal << " subedge balanced separators tried." << endl;
+
+	trace.setResult(htree != nullptr, interrupted());
+	return htree;
+}
+
+list<HypertreeSharedPtr> BalKDecomp::decompose(const SeparatorSharedPtr &Sep, const SuperedgeSharedPtr &Sup, const vector<DecompComponent> &Parts)
+{
+	HypergraphSharedPtr hypergraph;
+	unique_ptr<BalKDecomp> baldecomp;
+	HypertreeSharedPtr htree{ nullptr };
+	list<HypertreeSharedPtr> subtrees;
+	vector<HypergraphSharedPtr> hypergraphs;
+	// Hypertrees of the subgraphs known to be decomposable (nullptr for the others)
+	vector<HypertreeSharedPtr> succ_trees;
+	HypertreeSharedPtr succ;
+	bool failed = false;
+
+	for (auto part : Parts) {
+		failed = getHypergraph<HyperedgeVector>(hypergraph, succ, part.component(), Sup);
+		succ_trees.push_back(succ);
+		SearchStats::count(failed || succ != nullptr ? SearchStats::Counter::CacheHits : SearchStats::Counter::CacheMisses);
+		SearchTrace::event(SearchTrace::Kind::Cache, MyRecLevel + 1, failed ? SearchTrace::HitFailed : succ != nullptr ? SearchTrace::HitDecomposed : SearchTrace::Miss);
+
+		if (failed)
+			break;
+		else
+			hypergraphs.push_back(hypergraph);
+	}
+
+	if (!failed) {
+		int i = 0;
+		for (auto hg : hypergraphs) {
+			//hypergraph has been succesfully decomposed previously
+			if (succ_trees[i] != nullptr) {
+				htree = succ_trees[i]->clone();
+				subtrees.push_back(htree);
+			}
+			else {
+				baldecomp = make_unique<BalKDecomp>(hg, MyK, MyRecLevel + 1);
+				baldecomp->setBudget(MyBudget);
+				baldecomp->setEdgeOrder(MyOrder);
+				htree = baldecomp->buildHypertree();
+
+				if (htree == nullptr) {
+					// An interrupted search does not prove that the subgraph is undecomposable
+					if (!interrupted()) {
+						SearchStats::countComponent(MyRecLevel + 1, false);
+						cacheHypergraph(hg, nullptr);
+					}
+					break;
+				}
+				else {
+					SearchStats::countComponent(MyRecLevel + 1, true);
+					cacheHypergraph(hg, htree->clone());
+					subtrees.push_back(htree);
+				}
+			}
+			i++;
+		}
+	}
+
+	if (htree == nullptr)
+		subtrees.clear();
+
+
+	return subtrees;
+}
+
+HyperedgeVector BalKDecomp::getNeighborEdges(const HyperedgeVector &Edges) const
+{
+	HyperedgeVector neighbors;
+
+	for (auto he : Edges) {
+		if (!he->isHeavy())
+			neighbors.push_back(he);
+		for (auto v : he->allVertices())
+			for (auto n : MyBaseGraph->allVertexNeighbors(v))
+				if (find(neighbors.begin(),neighbors.end(),n) == neighbors.end())
+					neighbors.push_back(n);
+	}
+
+	return neighbors;
+}
+
+bool BalKDecomp::isBalanced(const vector<DecompComponent>& Parts, int CompSize)
+{
+	if (Parts.size() > 1) {
+		for (auto p : Parts)
+			if (p.size() > CompSize / 2)
+				return false;
+
+		return true;
+	}
+
+	return false;
+}
+
+BalKDecomp::BalKDecomp(const HypergraphSharedPtr &HGraph, int k, int RecLevel) : Decomp(HGraph, k), MyRecLevel{ RecLevel }, MyContext{ HGraph->core() }
+{
+	MySubedges = make_unique<Subedges>(HGraph, k);
+}
+
+BalKDecomp::~BalKDecomp()
+{
+}
+
+template<typename T>
+bool BalKDecomp::getHypergraph(HypergraphSharedPtr &Hg, HypertreeSharedPtr &HTree, const T &Part, const SuperedgeSharedPtr &Sup) const
+{
+	size_t cnt = Part.size() + (Sup != nullptr ? 1 : 0);
+
+	for (auto it = sCachedHg.begin(); it != sCachedHg.end(); it++) {
+		HypergraphSharedPtr hg = it->Hg;
+		bool found = true;
+
+		if (hg->getNbrOfEdges() == cnt) {
+			if (Sup != nullptr && !hg->hasEdge(Sup))
+				found = false;
+			if (found && !hg->hasAllEdges(Part))
+				found = false;
+		}
+		else
+			found = false;
+
+		if (found) {
+			// Keep recently used subgraphs at the front, so they are evicted last
+			sCachedHg.splice(sCachedHg.begin(), sCachedHg, it);
+			Hg = hg;
+			HTree = it->HTree;
+			return HTree == nullptr;
+		}
+	}
+
+
+	HyperedgeVector edges(Part.begin(), Part.end());
+
+	if (Sup != nullptr)
+		edges.push_back(Sup);
+
+	Hg = make_shared<Hypergraph>();
+	Hg->setParent(MyBaseGraph);
+	Hg->build(edges);
+	HTree = nullptr;
+	return false;
+}
+
+void BalKDecomp::cacheHypergraph(const HypergraphSharedPtr &Hg, const HypertreeSharedPtr &HTree)
+{
+	size_t bytes = sizeof(CachedHg) + 2 * sizeof(void *) + hypergraphBytes(*Hg) + (HTree != nullptr ? hypertreeBytes(*HTree) : 0);
+
+	sCachedHg.push_front({ Hg, HTree, bytes });
+	sCacheBytes += bytes;
+	SearchStats::addCacheBytes(bytes);
+
+	while (sCacheLimit > 0 && sCacheBytes > sCacheLimit && sCachedHg.size() > 1) {
+		sCacheBytes -= sCachedHg.back().Bytes;
+		SearchStats::releaseCacheBytes(sCachedHg.back().Bytes);
+		SearchStats::count(SearchStats::Counter::CacheEvictions);
+		sCachedHg.pop_back();
+	}
+}
+
+void BalKDecomp::uncacheHypergraphs(bool Succ)
+{
+	for (auto it = sCachedHg.begin(); it != sCachedHg.end(); )
+		if ((it->HTree != nullptr) == Succ) {
+			sCacheBytes -= it->Bytes;
+			SearchStats::releaseCacheBytes(it->Bytes);
+			it = sCachedHg.erase(it);
+		}
+		else
+			it++;
+}
+
+void BalKDecomp::setCacheLimit(size_t Bytes)
+{
+	sCacheLimit = Bytes;
+}
+
+/*
+***Description***
+The method expands pruned hypertree nodes, i.e., subgraphs which were not decomposed but are
+known to be decomposable are decomposed.
+
+INPUT:	HTree: Hypertree that has to be expanded
+OUTPUT: HTree: Expanded hypertree
+*/
+
+void BalKDecomp::expandHTree(const HypertreeSharedPtr &HTree)
+{
+	HypertreeSharedPtr cut_node;
+	HypertreeSharedPtr subtree;
+	HyperedgeSet lambda;
+	HypergraphSharedPtr hg;
+	HypertreeSharedPtr succ;
+	unique_ptr<BalKDecomp> baldecomp;
+	//set<Hyperedge *>::iterator SetIter1;
+	//set<Node *>::iterator SetIter2;
+
+	/*
+	ParentSep = new Hyperedge*[iMyK+1];
+	if(ParentSep == NULL)
+	writeErrorMsg("Error assigning memory.", "DetKDecomp::expandHTree");
+	*/
+
+	while ((cut_node = HTree->getCutNode()) != nullptr) {
+		// Store subgraph in an array
+		lambda = cut_node->getLambda();
+
+		// Get subgraph (it is rebuilt if it was evicted from the cache meanwhile)
+		if (getHypergraph<HyperedgeSet>(hg, succ, lambda))
+			writeErrorMsg("Hypergraph was not successfully decomposed!", "BalKDecomp::expandHTree");
+		
+		// Decompose subgraph
+		baldecomp = make_unique<BalKDecomp>(hg, MyK, cut_node->getLabel());
+		baldecomp->setEdgeOrder(MyOrder);
+		subtree = baldecomp->buildHypertree();
+		baldecomp = nullptr;
+
+		
+		if (subtree == nullptr && interrupted())
+			return;
+		if (subtree == nullptr)
+			writeErrorMsg("Illegal decomposition pruning.", "BalKDecomp::expandHTree");
+
+		
+		HypertreeSharedPtr parent = cut_node->getParent().lock();
+
+		// Replace the pruned node by the corresponding subtree
+		parent->insChild(subtree);
+		parent->remChild(cut_node);
+
+	}
+}
+
+HypertreeSharedPtr BalKDecomp::buildHypertree()
+{
+	HypertreeSharedPtr HTree;
+	
+	if (MyMaxRecursion == 0 || MyRecLevel < MyMaxRecursion) {
+		HyperedgeVector HEdges;
+
+		// Order hyperedges heuristically
+		HEdges = MyHg->getEdgeOrder(MyOrder);
+
+		// Store initial heuristic order as weight
+		//for (int i = 0; i < HEdges.size(); i++)
+		//	HEdges[i]->setWeight(i);
+
+
+		// Build hypertree decomposition
+		HTree = decomp(HEdges);
+	}
+	else {
+		// Use normal DetKDecomp
+		DetKDecomp Decomp(MyHg, MyK, true);
+
+		Decomp.setBudget(MyBudget);
+		Decomp.setEdgeOrder(MyOrder);
+		HTree = Decomp.buildHypertree();
+	}
+
+	if (MyRecLevel == 0 && HTree != nullptr && HTree->getCutNode() != nullptr) {
+		*MyLog << "Expanding hypertree ..." << endl;
+		expandHTree(HTree);
+
+		// A cancelled expansion leaves pruned nodes behind
+		if (HTree->getCutNode() != nullptr)
+			HTree = nullptr;
+	}
+
+
+	return HTree;
+}
+
+/*
+***Description***
+The method changes the maximum width of the decomposition. Subgraphs decomposed with width k
+remain decomposable with any larger width and failed subgraphs remain undecomposable with any
+smaller width, so only the cache entries that may become invalid are discarded.
+
+INPUT:	k: New maximum width
+*/
+
+void BalKDecomp::setWidth(int k)
+{
+	if (k > MyK)
+		uncacheHypergraphs(false);
+	else if (k < MyK)
+		uncacheHypergraphs(true);
+
+	// Subedges depend on the width
+	if (k != MyK)
+		MySubedges = make_unique<Subedges>(MyHg, k);
+
+	Decomp::setWidth(k);
+}
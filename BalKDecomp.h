@@ -9,6 +9,7 @@
 
 #include "Globals.h"
 #include "Decomp.h"
+#include "SearchContext.h"
 
 class Hypertree;
 class Subedges;
@@ -17,12 +18,33 @@ class BalKDecomp :
 	public Decomp
 {
 private:
-	static list<HypergraphSharedPtr> sFailedHg;
-	static unordered_map<HypergraphSharedPtr, HypertreeSharedPtr> sSuccHg;
+	// Subgraph known to be decomposable (HTree != nullptr) or undecomposable (HTree == nullptr)
+	struct CachedHg {
+		HypergraphSharedPtr Hg;
+		HypertreeSharedPtr HTree;
+		// Estimated memory of the entry in bytes
+		size_t Bytes;
+	};
+
+	// Decomposed and failed subgraphs (most recently used first)
+	static list<CachedHg> sCachedHg;
+
+	// Estimated memory of sCachedHg and its limit in bytes (0 if unlimited)
+	static size_t sCacheBytes;
+	static size_t sCacheLimit;
+
+	// Adds a subgraph to the cache and evicts the subgraphs used least recently if the limit is exceeded
+	static void cacheHypergraph(const HypergraphSharedPtr &Hg, const HypertreeSharedPtr &HTree);
+
+	// Removes the cached subgraphs that are decomposable (Succ = true) resp. undecomposable
+	static void uncacheHypergraphs(bool Succ);
 
 	int MyRecLevel;
 	std::unique_ptr<Subedges> MySubedges;
 
+	// Labels of vertices and edges used during the search
+	SearchContext MyContext;
+
 	HypertreeSharedPtr decomp(const HyperedgeVector &HEdges);
 	list<HypertreeSharedPtr> decompose(const SeparatorSharedPtr &Sep, const SuperedgeSharedPtr &Sup, const vector<DecompComponent> &Parts);
 	
@@ -32,10 +54,11 @@ private:
 	
 	void expandHTree(const HypertreeSharedPtr &HTree);
 	
-	// Finds or constructs a hypergraph from a list of edges and a superedge
-	// Returns false if hypergraph is in sFailedHg
+	// Finds or constructs a hypergraph from a list of edges and a superedge; HTree is the
+	// hypertree of the hypergraph if it is known to be decomposable (nullptr otherwise)
+	// Returns true if the hypergraph is known to be undecomposable
 	template<typename T>
-	bool getHypergraph(HypergraphSharedPtr &Hg, bool &Succ, const T &Part, const SuperedgeSharedPtr &Sup = nullptr) const;
+	bool getHypergraph(HypergraphSharedPtr &Hg, HypertreeSharedPtr &HTree, const T &Part, const SuperedgeSharedPtr &Sup = nullptr) const;
 
 public:
 	static int MyMaxRecursion;
@@ -49,6 +72,12 @@ public:
 	// Constructs a hypertree decomposition of width at most MyK (if it exists)
 	virtual HypertreeSharedPtr buildHypertree();
 
+	// Changes the maximum width; decomposed subgraphs are kept if k grows, failed ones if k shrinks
+	virtual void setWidth(int k);
+
+	// Limits the estimated memory of the cache of decomposed and failed subgraphs (0 if unlimited)
+	static void setCacheLimit(size_t Bytes);
+
 	static void init(const HypergraphSharedPtr &BaseGraph, int MaxRecursion = 0) {
 		MyMaxRecursion = MaxRecursion;
 		MyBaseGraph = BaseGraph;
@@ -1,17 +1,43 @@
-#include "BaseSeparator.h"
-
-
-
-BaseSeparator::BaseSeparator()
-{
-}
-
-
-BaseSeparator::~BaseSeparator()
-{
-}
-
-bool operator==(const  std::shared_ptr<BaseSeparator> & lhs, const  std::shared_ptr<BaseSeparator> & rhs)
-{
-	return lhs->covers() == rhs->covers();
-}
\ No newline at end of file
+#include <algorithm>
+
+#include "BaseSeparator.h"
+
+
+
+BaseSeparator::BaseSeparator(const HypergraphCoreSharedPtr &core) : MyCore{ core }
+{
+}
+
+
+BaseSeparator::~BaseSeparator()
+{
+}
+
+void BaseSeparator::addToSignature(uint id)
+{
+	MySignature.insert(upper_bound(MySignature.begin(), MySignature.end(), id), id);
+	updateHash();
+}
+
+void BaseSeparator::removeFromSignature(uint id)
+{
+	auto it = lower_bound(MySignature.begin(), MySignature.end(), id);
+
+	if (it != MySignature.end() && *it == id) {
+		MySignature.erase(it);
+		updateHash();
+	}
+}
+
+void BaseSeparator::updateHash()
+{
+	MyHash = MySignature.size();
+
+	for (auto id : MySignature)
+		MyHash ^= std::hash<uint>()(id) + 0x9e3779b9 + (MyHash << 6) + (MyHash >> 2);
+}
+
+bool operator==(const  std::shared_ptr<BaseSeparator> & lhs, const  std::shared_ptr<BaseSeparator> & rhs)
+{
+	return lhs->covers() == rhs->covers();
+}
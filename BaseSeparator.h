@@ -1,29 +1,80 @@
-#pragma once
-
-#if !defined(CLS_BASESEPARATOR)
-#define CLS_BASESEPARATOR
-
-#include<string>
-
-#include "Hyperedge.h"
-
-class BaseSeparator
-{
-public:
-	BaseSeparator();
-	virtual ~BaseSeparator();
-
-	virtual void label(int lbl = -1) const = 0;
-
-	virtual bool contains(const VertexSharedPtr &v) const = 0;
-
-	virtual bool empty() const = 0;
-
-	virtual VertexSet covers() = 0;
-
-	friend bool operator==(const  std::shared_ptr<BaseSeparator>& lhs, const  std::shared_ptr<BaseSeparator>& rhs);
-};
-
-using BaseSeparatorSharedPtr = std::shared_ptr<BaseSeparator>;
-
-#endif
\ No newline at end of file
+#pragma once
+
+#if !defined(CLS_BASESEPARATOR)
+#define CLS_BASESEPARATOR
+
+#include<string>
+#include<vector>
+
+#include "IndexSet.h"
+#include "Hyperedge.h"
+#include "HypergraphCore.h"
+
+class BaseSeparator
+{
+protected:
+	// Hypergraph the index sets of the separator are indexed against
+	HypergraphCoreSharedPtr MyCore;
+
+	// Vertices covered by the separator (indexed by MyCore)
+	IndexSet MyCoveredVertices;
+
+	// Sorted IDs of the entities forming the separator (canonical form)
+	vector<uint> MySignature;
+
+	// Hash value of MySignature
+	size_t MyHash{ 0 };
+
+	// Inserts an ID into the signature and updates the hash value
+	void addToSignature(uint id);
+
+	// Removes an ID from the signature and updates the hash value
+	void removeFromSignature(uint id);
+
+	// Recomputes the hash value of the signature
+	void updateHash();
+
+public:
+	BaseSeparator(const HypergraphCoreSharedPtr &core);
+	virtual ~BaseSeparator();
+
+	// Returns the hypergraph the separator is indexed against
+	const HypergraphCoreSharedPtr &core() const { return MyCore; }
+
+	// Returns the indices of the core vertices covered by the separator
+	const IndexSet &coveredVertices() const { return MyCoveredVertices; }
+
+	virtual bool contains(const VertexSharedPtr &v) const = 0;
+
+	virtual bool empty() const = 0;
+
+	virtual VertexSet covers() = 0;
+
+	// Returns the canonical signature, i.e., the sorted IDs of the separator
+	const vector<uint> &signature() const { return MySignature; }
+
+	// Returns the precomputed hash value of the signature
+	size_t hash() const { return MyHash; }
+
+	friend bool operator==(const  std::shared_ptr<BaseSeparator>& lhs, const  std::shared_ptr<BaseSeparator>& rhs);
+};
+
+using BaseSeparatorSharedPtr = std::shared_ptr<BaseSeparator>;
+
+// Hashes separators by their canonical signature
+struct SeparatorHash {
+	template<typename T>
+	size_t operator() (const std::shared_ptr<T> &sep) const {
+		return sep->hash();
+	}
+};
+
+// Compares separators by their canonical signature
+struct SeparatorEqual {
+	template<typename T>
+	bool operator() (const std::shared_ptr<T> &lhs, const std::shared_ptr<T> &rhs) const {
+		return lhs->hash() == rhs->hash() && lhs->signature() == rhs->signature();
+	}
+};
+
+#endif
@@ -0,0 +1,274 @@
+#include <algorithm>
+#include <numeric>
+
+#include "BlockDecomp.h"
+#include "HypergraphCore.h"
+#include "WorkStealingPool.h"
+
+/*
+***Description***
+The method assigns each hyperedge the index of its block. Without Biconnected the blocks are
+the connected components. Otherwise the biconnected components of the incidence graph are
+computed (Hopcroft-Tarjan) and all components sharing a hyperedge are merged, so blocks only
+meet at cut vertices of the hypergraph and form a tree.
+
+INPUT:	Biconnected: Split connected components at cut vertices
+OUTPUT: Labels: Block index of each hyperedge (in the order of the hypergraph core)
+*/
+
+void BlockDecomp::labelBlocks(bool Biconnected, vector<int> &Labels) const
+{
+	const HypergraphCore &hg = *MyHg->core();
+	int cnt_edges = (int)hg.nbrOfEdges(), cnt_vertices = (int)hg.nbrOfVertices();
+	vector<int> sets(cnt_edges);
+	vector<int> ids(cnt_edges, -1);
+	int cnt_blocks{ 0 };
+
+	// Union-find over the hyperedges
+	iota(sets.begin(), sets.end(), 0);
+	auto find = [&](int e) {
+		while (sets[e] != e)
+			e = sets[e] = sets[sets[e]];
+		return e;
+	};
+	auto unite = [&](int e, int f) { sets[find(e)] = find(f); };
+
+	if (!Biconnected) {
+		for (int e = 0; e < cnt_edges; e++)
+			for (auto n : hg.edgeNeighbors(e))
+				unite(e, n);
+	}
+	else {
+		// Nodes of the incidence graph: vertices 0..cnt_vertices-1 followed by the hyperedges
+		int cnt = cnt_vertices + cnt_edges, time{ 0 };
+		vector<int> disc(cnt, -1), low(cnt, 0), parent(cnt, -1);
+		vector<size_t> next(cnt, 0);
+		vector<int> stack, nodes;
+
+		auto degree = [&](int u) { return u < cnt_vertices ? hg.vertexDegree(u) : hg.edgeSize(u - cnt_vertices); };
+		auto neighbor = [&](int u, size_t i) {
+			return u < cnt_vertices ? cnt_vertices + (int)hg.vertexEdges(u).begin()[i] : (int)hg.edgeVertices(u - cnt_vertices).begin()[i];
+		};
+
+		for (int s = cnt_vertices; s < cnt; s++) {
+			if (disc[s] >= 0)
+				continue;
+
+			// Iterative depth-first search
+			disc[s] = low[s] = time++;
+			stack.push_back(s);
+			nodes.push_back(s);
+			while (!stack.empty()) {
+				int u = stack.back();
+				if (next[u] < degree(u)) {
+					int w = neighbor(u, next[u]++);
+					if (disc[w] < 0) {
+						parent[w] = u;
+						disc[w] = low[w] = time++;
+						stack.push_back(w);
+						nodes.push_back(w);
+					}
+					else if (w != parent[u])
+						low[u] = min(low[u], disc[w]);
+				}
+				else {
+					stack.pop_back();
+					int p = parent[u];
+					if (p >= 0) {
+						low[p] = min(low[p], low[u]);
+
+						// The nodes above u together with p form a biconnected component
+						if (low[u] >= disc[p]) {
+							int first = p >= cnt_vertices ? p - cnt_vertices : -1, w;
+							do {
+								w = nodes.back();
+								nodes.pop_back();
+								if (w >= cnt_vertices) {
+									if (first < 0)
+										first = w - cnt_vertices;
+									else
+										unite(first, w - cnt_vertices);
+								}
+							} while (w != u);
+						}
+					}
+				}
+			}
+			nodes.clear();
+		}
+	}
+
+	// Number the blocks in the order of their first hyperedge
+	Labels.resize(cnt_edges);
+	for (int e = 0; e < cnt_edges; e++) {
+		int &id = ids[find(e)];
+		if (id < 0)
+			id = cnt_blocks++;
+		Labels[e] = id;
+	}
+}
+
+BlockDecomp::BlockDecomp(const HypergraphSharedPtr &HGraph, bool Biconnected) : MyHg{ HGraph }
+{
+	const HypergraphCore &hg = *MyHg->core();
+	vector<int> labels, order, position;
+	int cnt_blocks{ 0 };
+
+	labelBlocks(Biconnected, labels);
+	for (auto l : labels)
+		cnt_blocks = max(cnt_blocks, l + 1);
+
+	vector<HyperedgeVector> edges(cnt_blocks);
+	for (size_t e = 0; e < labels.size(); e++)
+		edges[labels[e]].push_back(hg.edge(e));
+
+	// Blocks containing each vertex (several ones for cut vertices) and cut vertices of each block
+	vector<vector<int>> vertex_blocks(hg.nbrOfVertices());
+	vector<vector<uint>> block_cuts(cnt_blocks);
+	for (uint v = 0; v < hg.nbrOfVertices(); v++) {
+		for (auto e : hg.vertexEdges(v))
+			if (find(vertex_blocks[v].begin(), vertex_blocks[v].end(), labels[e]) == vertex_blocks[v].end())
+				vertex_blocks[v].push_back(labels[e]);
+		if (vertex_blocks[v].size() > 1)
+			for (auto b : vertex_blocks[v])
+				block_cuts[b].push_back(v);
+	}
+
+	// Traverse each block tree breadth-first starting from its largest block
+	order.resize(cnt_blocks);
+	iota(order.begin(), order.end(), 0);
+	stable_sort(order.begin(), order.end(), [&](int a, int b) { return edges[a].size() > edges[b].size(); });
+	position.resize(cnt_blocks, -1);
+	vector<int> queue;
+	for (auto b : order) {
+		if (position[b] >= 0)
+			continue;
+
+		position[b] = (int)queue.size();
+		queue.push_back(b);
+		MyParents.push_back(-1);
+		MyCutVertices.push_back(nullptr);
+		for (size_t i = position[b]; i < queue.size(); i++)
+			for (auto v : block_cuts[queue[i]])
+				for (auto c : vertex_blocks[v])
+					if (position[c] < 0) {
+						position[c] = (int)queue.size();
+						queue.push_back(c);
+						MyParents.push_back((int)i);
+						MyCutVertices.push_back(hg.vertex(v));
+					}
+	}
+
+	for (auto b : queue) {
+		if (cnt_blocks == 1)
+			MyBlocks.push_back(MyHg);
+		else {
+			HypergraphSharedPtr block = make_shared<Hypergraph>();
+			block->build(edges[b]);
+			MyBlocks.push_back(block);
+		}
+	}
+}
+
+size_t BlockDecomp::maxBlockSize() const
+{
+	size_t size{ 0 };
+
+	for (auto &block : MyBlocks)
+		size = max(size, block->getNbrOfEdges());
+
+	return size;
+}
+
+HypertreeSharedPtr BlockDecomp::findNode(const HypertreeSharedPtr &HTree, const VertexSharedPtr &V)
+{
+	HypertreeSharedPtr node{ nullptr };
+
+	if (HTree->getChi().find(V) != HTree->getChi().end())
+		return HTree;
+
+	for (auto &child : HTree->allChildren())
+		if ((node = findNode(child, V)) != nullptr)
+			return node;
+
+	return nullptr;
+}
+
+/*
+***Description***
+The method decomposes all blocks and glues the hypertrees. Each block sharing a cut vertex
+with its parent block is decomposed such that its root covers the cut vertex (if the solver
+ignores this, the hypertree is re-rooted at a node covering it) and appended to a node of the
+parent's hypertree covering the cut vertex. The hypertrees of further connected components
+are appended to the root. Since blocks only share their cut vertices, the glued hypertree
+satisfies all conditions satisfied by the hypertrees of the blocks and has the maximum width
+of the blocks.
+
+INPUT:	Solve: Decomposes a single block
+OUTPUT: return: Hypertree of the whole hypergraph (nullptr if some block cannot be decomposed)
+*/
+
+HypertreeSharedPtr BlockDecomp::buildHypertree(const BlockSolver &Solve) const
+{
+	size_t cnt_blocks{ MyBlocks.size() };
+	vector<HypertreeSharedPtr> trees(cnt_blocks);
+
+	if (cnt_blocks <= 1)
+		return Solve(MyHg, VertexSet());
+
+	auto solve = [&](size_t i) {
+		VertexSet root;
+		if (MyCutVertices[i] != nullptr)
+			root.insert(MyCutVertices[i]);
+		trees[i] = Solve(MyBlocks[i], root);
+	};
+
+	if (MyNbrOfThreads > 1) {
+		WorkStealingPool pool(MyNbrOfThreads);
+		TaskGroup blocks(pool);
+
+		// A single undecomposable block makes the whole search fail
+		for (size_t i = 0; i < cnt_blocks; i++)
+			blocks.run([&, i] {
+				solve(i);
+				if (trees[i] == nullptr)
+					blocks.cancel();
+			});
+		blocks.wait();
+	}
+	else
+		for (size_t i = 0; i < cnt_blocks; i++) {
+			solve(i);
+			if (trees[i] == nullptr)
+				break;
+		}
+
+	for (auto &tree : trees)
+		if (tree == nullptr)
+			return nullptr;
+
+	for (size_t i = 1; i < cnt_blocks; i++) {
+		if (MyParents[i] < 0) {
+			trees[0]->insChild(trees[i]);
+			continue;
+		}
+
+		const VertexSharedPtr &v = MyCutVertices[i];
+		if (trees[i]->getChi().find(v) == trees[i]->getChi().end()) {
+			HypertreeSharedPtr node = findNode(trees[i], v);
+			if (node == nullptr)
+				writeErrorMsg("Cut vertex " + v->getName() + " is not covered.", "BlockDecomp::buildHypertree");
+			node->setRoot();
+			trees[i] = node;
+		}
+
+		HypertreeSharedPtr parent = findNode(trees[MyParents[i]], v);
+		if (parent == nullptr)
+			writeErrorMsg("Cut vertex " + v->getName() + " is not covered.", "BlockDecomp::buildHypertree");
+		parent->insChild(trees[i]);
+	}
+
+	trees[0]->setHypergraph(MyHg);
+
+	return trees[0];
+}
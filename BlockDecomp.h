@@ -0,0 +1,64 @@
+#pragma once
+// Splits a hypergraph into its connected components and (optionally) into the blocks of its
+// incidence graph joined at cut vertices, decomposes each block independently and glues the
+// hypertrees of the blocks at the shared vertices.
+//
+//////////////////////////////////////////////////////////////////////
+
+#if !defined(CLS_BLOCKDECOMP)
+#define CLS_BLOCKDECOMP
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "Globals.h"
+#include "Hypergraph.h"
+#include "Hypertree.h"
+#include "Vertex.h"
+
+class BlockDecomp
+{
+public:
+	// Decomposes a block such that the root of the hypertree covers the given vertices (if possible)
+	using BlockSolver = function<HypertreeSharedPtr(const HypergraphSharedPtr &Block, const VertexSet &Root)>;
+
+private:
+	HypergraphSharedPtr MyHg;
+
+	// Blocks in breadth-first order of the block tree(s)
+	vector<HypergraphSharedPtr> MyBlocks;
+
+	// Parent of each block in the block tree (-1 for the first block of each connected component)
+	vector<int> MyParents;
+
+	// Cut vertex shared by each block with its parent (nullptr if there is no parent)
+	VertexVector MyCutVertices;
+
+	// Number of threads used to decompose the blocks concurrently
+	size_t MyNbrOfThreads{ 1 };
+
+	// Assigns each hyperedge the index of its block
+	void labelBlocks(bool Biconnected, vector<int> &Labels) const;
+
+	// Returns a hypertree-node in the subtree whose chi-set contains the vertex
+	static HypertreeSharedPtr findNode(const HypertreeSharedPtr &HTree, const VertexSharedPtr &V);
+
+public:
+	// Splits the hypergraph into connected components and, if Biconnected, further into blocks
+	BlockDecomp(const HypergraphSharedPtr &HGraph, bool Biconnected = false);
+
+	// Returns the number of blocks
+	size_t nbrOfBlocks() const { return MyBlocks.size(); }
+
+	// Returns the number of hyperedges of the largest block
+	size_t maxBlockSize() const;
+
+	// Decomposes the blocks concurrently using the given number of threads
+	void setParallel(size_t NbrOfThreads) { MyNbrOfThreads = NbrOfThreads; }
+
+	// Decomposes all blocks and glues the hypertrees; returns nullptr if some block cannot be decomposed
+	HypertreeSharedPtr buildHypertree(const BlockSolver &Solve) const;
+};
+
+#endif
@@ -0,0 +1,132 @@
+#include "ComponentTable.h"
+#include "SearchStats.h"
+#include "SeparatorCache.h"
+
+size_t ComponentTable::rootBytes(const HypertreeSharedPtr &Subtree)
+{
+	if (Subtree == nullptr)
+		return 0;
+
+	// Node, its chi- and lambda-sets (tree nodes of about four pointers), and its child pointers
+	auto children = Subtree->allChildren();
+	size_t nbr_of_children = (size_t)distance(children.begin(), children.end());
+
+	return sizeof(Hypertree) + (Subtree->getChi().size() + Subtree->getLambda().size() + nbr_of_children) * 4 * sizeof(void *);
+}
+
+void ComponentTable::remove(list<Entry>::iterator Pos)
+{
+	MyBytes -= Pos->Bytes;
+	SearchStats::releaseCacheBytes(Pos->Bytes);
+	MyIndex.erase(Pos->Comp);
+	MyEntries.erase(Pos);
+}
+
+bool ComponentTable::lookup(const CompFingerprint &Comp, bool &Decomposable, HypertreeSharedPtr *Subtree)
+{
+	lock_guard<mutex> guard(MyLock);
+	auto it = MyIndex.find(Comp);
+
+	if (it == MyIndex.end()) {
+		MyMisses++;
+		return false;
+	}
+
+	MyHits++;
+	SearchStats::count(SearchStats::Counter::TableHits);
+	MyEntries.splice(MyEntries.begin(), MyEntries, it->second);
+	Decomposable = it->second->Decomposable;
+	if (Subtree != nullptr)
+		*Subtree = it->second->Subtree;
+	return true;
+}
+
+
+/*
+***Description***
+The method records the outcome of a component. The decomposition is stored without copying
+it: the search only links it into the decompositions of larger components, which contain the
+same nodes, so an entry only adds the root of its decomposition to the memory. Copies are made
+when pruned nodes are expanded. A decomposition replaces an earlier entry without one (e.g., of
+a component whose outcome was taken from a persistent store). If the limit is exceeded, the
+components used least recently are evicted.
+
+INPUT:	Comp: Fingerprint of the component
+		Decomposable: true if the component is decomposable
+		Subtree: Decomposition of the component (nullptr if it is undecomposable or unknown)
+*/
+
+void ComponentTable::record(const CompFingerprint &Comp, bool Decomposable, const HypertreeSharedPtr &Subtree)
+{
+	size_t bytes{ CompCache::fingerprintBytes(Comp) + sizeof(Entry) + 4 * sizeof(void *) + rootBytes(Subtree) };
+	lock_guard<mutex> guard(MyLock);
+	auto it = MyIndex.find(Comp);
+
+	if (it != MyIndex.end()) {
+		if (it->second->Subtree != nullptr || Subtree == nullptr)
+			return;
+		remove(it->second);
+	}
+	else
+		SearchStats::count(SearchStats::Counter::TableRecorded);
+
+	MyEntries.push_front({ Comp, Decomposable, Subtree, bytes });
+	MyIndex[Comp] = MyEntries.begin();
+	MyBytes += bytes;
+	SearchStats::addCacheBytes(bytes);
+
+	while (MyLimit > 0 && MyBytes > MyLimit && MyEntries.size() > 1) {
+		remove(prev(MyEntries.end()));
+		SearchStats::count(SearchStats::Counter::CacheEvictions);
+	}
+}
+
+void ComponentTable::clearDecomposable()
+{
+	lock_guard<mutex> guard(MyLock);
+
+	for (auto it = MyEntries.begin(); it != MyEntries.end(); )
+		if (it->Decomposable)
+			remove(it++);
+		else
+			++it;
+}
+
+void ComponentTable::clearUndecomposable()
+{
+	lock_guard<mutex> guard(MyLock);
+
+	for (auto it = MyEntries.begin(); it != MyEntries.end(); )
+		if (!it->Decomposable)
+			remove(it++);
+		else
+			++it;
+}
+
+void ComponentTable::clearSubtrees()
+{
+	lock_guard<mutex> guard(MyLock);
+
+	for (auto &entry : MyEntries)
+		if (entry.Subtree != nullptr) {
+			size_t bytes{ rootBytes(entry.Subtree) };
+			entry.Subtree = nullptr;
+			entry.Bytes -= bytes;
+			MyBytes -= bytes;
+			SearchStats::releaseCacheBytes(bytes);
+		}
+}
+
+void ComponentTable::clear()
+{
+	lock_guard<mutex> guard(MyLock);
+
+	while (!MyEntries.empty())
+		remove(MyEntries.begin());
+}
+
+void ComponentTable::setLimit(size_t Bytes)
+{
+	lock_guard<mutex> guard(MyLock);
+	MyLimit = Bytes;
+}
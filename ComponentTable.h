@@ -0,0 +1,87 @@
+#pragma once
+// Models the table of all components decomposed by a search, whichever separator produced them.
+// Each component is identified by its fingerprint, i.e., its edges and connector, and is stored
+// with its outcome and, if it is decomposable, its hypertree decomposition. Separators producing
+// a component again reuse the outcome, and pruned hypertree nodes are expanded by copying the
+// stored decomposition instead of decomposing the component once more. The decompositions are
+// shared with the search, which links them into the decompositions of larger components, and
+// are only copied when a pruned node is expanded. If the estimated memory exceeds a limit, the
+// components used least recently are evicted.
+//
+//////////////////////////////////////////////////////////////////////
+
+#if !defined(CLS_COMPONENTTABLE)
+#define CLS_COMPONENTTABLE
+
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+#include "Globals.h"
+#include "DecompComponent.h"
+#include "Hypertree.h"
+
+class ComponentTable
+{
+private:
+	struct Entry {
+		CompFingerprint Comp;
+		bool Decomposable;
+		// Decomposition of the component (nullptr if it is undecomposable)
+		HypertreeSharedPtr Subtree;
+		size_t Bytes;
+	};
+
+	// Entries ordered by their last use (most recently used first)
+	list<Entry> MyEntries;
+	unordered_map<CompFingerprint, list<Entry>::iterator, CompFingerprintHash> MyIndex;
+
+	// Estimated memory of all entries and its limit in bytes (0 if unlimited)
+	size_t MyBytes{ 0 };
+	size_t MyLimit{ 0 };
+
+	// Number of components found resp. not found
+	size_t MyHits{ 0 };
+	size_t MyMisses{ 0 };
+
+	mutable mutex MyLock;
+
+	// Removes an entry (the lock has to be held)
+	void remove(list<Entry>::iterator Pos);
+
+	// Returns the estimated memory of the root of a hypertree (its descendants are charged to the
+	// entries of their components)
+	static size_t rootBytes(const HypertreeSharedPtr &Subtree);
+
+public:
+	ComponentTable() {}
+	~ComponentTable() { clear(); }
+
+	// Looks up a component; returns false if its outcome is unknown. Subtree is set to the stored
+	// decomposition of a decomposable component (nullptr if none is stored), which has to be
+	// copied before it is changed
+	bool lookup(const CompFingerprint &Comp, bool &Decomposable, HypertreeSharedPtr *Subtree = nullptr);
+
+	// Records the outcome of a component and its decomposition (if it is known), which must not be
+	// changed afterwards
+	void record(const CompFingerprint &Comp, bool Decomposable, const HypertreeSharedPtr &Subtree = nullptr);
+
+	// Drops the stored decompositions, but keeps the outcomes
+	void clearSubtrees();
+
+	// Removes the decomposable resp. undecomposable components
+	void clearDecomposable();
+	void clearUndecomposable();
+
+	// Removes all components
+	void clear();
+
+	// Limits the estimated memory of the table (0 if unlimited)
+	void setLimit(size_t Bytes);
+
+	size_t size() const { lock_guard<mutex> guard(MyLock); return MyEntries.size(); }
+	size_t hits() const { lock_guard<mutex> guard(MyLock); return MyHits; }
+	size_t misses() const { lock_guard<mutex> guard(MyLock); return MyMisses; }
+};
+
+#endif
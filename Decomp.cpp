@@ -1,202 +1,262 @@
-#include <cmath>
-
-#include "Decomp.h"
-#include "Hyperedge.h"
-#include "Hypergraph.h"
-#include "Hypertree.h"
-#include "Superedge.h"
-#include "Separator.h"
-#include "DecompComponent.h"
-
-Decomp::~Decomp()
-{
-}
-
-/*
-***Description***
-The method partitions a given set of hyperedges into connected components, i.e., into sets
-of hyperedges in the same component and sets of nodes connecting the components with the
-separator. 
-
-INPUT:	HEdges: Hyperedges to be partitioned
-OUTPUT: Partitions: Components consisting of sets of hyperedges
-Connectors: Sets of nodes connecting each component with the separator
-return: Number of components
-*/
- 
-size_t Decomp::separate(const SeparatorSharedPtr &sep, const HyperedgeVector &edges, vector<DecompComponent> &partitions) const
-{
-	int label = 0;
-	unordered_map<HyperedgeSharedPtr, int, NamedEntityHash> eLabels;
-	unordered_map<VertexSharedPtr, int, NamedEntityHash> vLabels;
-
-	partitions.clear();
-
-	//First set the label for all seperating vertices and edges
-	for (auto &e : sep->allEdges()) {
-		eLabels[e] = -1;
-		for (auto &v : e->allVertices())
-			vLabels[v] = -1;
-	}
-
-	for (auto &he : edges)
-		if (eLabels[he] == 0) {
-			DecompComponent comp(static_pointer_cast<BaseSeparator>(sep));
-			label++;
-
-			comp.add(he);
-			eLabels[he] = label;
-			
-			//find all edges reachable from the current component
-			for (int i = 0; i < comp.size(); i++) {
-				for (auto &v : comp[i]->allVertices()) {
-					if (vLabels[v] == 0) {
-						vLabels[v] = label;
-						for (auto &he : MyHg->allVertexNeighbors(v))
-							if (eLabels[he] == 0) {
-								eLabels[he] = label;
-								comp.add(he);
-							}
-					}
-				}
-			}
-
-			partitions.push_back(comp);
-		}
-
-	return partitions.size();
-}
-
-HypertreeSharedPtr Decomp::decompTrivial(const HyperedgeVector &edges, const VertexSet &connector) const
-{
-	HypertreeSharedPtr htree{ nullptr };
-	size_t total_weight = 0;
-
-	for (auto &e : edges)
-		total_weight += e->getWeight();
-	
-	// Stop if the hypergraph can be decomposed into a single hypertree-node
-	if (total_weight <= MyK)
-		return getHTNode(edges, edges, connector);
-
-	if (connector.size() == 0) {
-		// check if there are heavy edges (weight != cnt)
-		if (edges.size() == total_weight) {
-			// Stop if the hypergraph can be decomposed into two hypertree-nodes 
-			if ((edges.size() > 1) && ((int)ceil(edges.size() / 2.0) <= MyK)) {
-				HyperedgeVector part;
-				int half = (int)edges.size() / 2;
-				int i = 0;
-				for (auto &he : edges) {
-					part.push_back(he);
-					if (i == half) {
-						htree = getHTNode(edges, part);
-						part.clear();
-					}
-					i++;
-				}
-
-				htree->insChild(getHTNode(edges, part));
-
-				return htree;
-			}
-		}
-		else {
-			// decompose in 2 hypertree nodes if possible
-			if (total_weight <= MyK * 2) {
-				HyperedgeVector part;
-				SuperedgeSharedPtr heavy{ nullptr };
-				// find the first heavy edge
-				for (auto it = edges.begin(); heavy == nullptr && it != edges.end(); it++)
-					if ((*it)->isHeavy())
-						heavy = dynamic_pointer_cast<Superedge>(*it);
-
-				// put all other edges into the first bag
-				for (auto &he : edges)
-					if (he != heavy) 
-						part.push_back(he);
-
-				
-				// create htree node
-				htree = getHTNode(edges, part);
-
-				// create second htree node
-				part.clear();
-				part.push_back(heavy);
-				htree->insChild(getHTNode(edges,part));
-
-				return htree;
-			}
-		}
-	}
-
-	
-
-	return htree;
-}
-
-
-/*
-***Description***
-The method creates a new hypertree-node, inserts the given hyperedges into the lambda-set,
-inserts the nodes of hyperedges labeled by -1 to the chi-set, inserts the nodes in
-ChiConnect to the chi-set, and adds the given hypertrees as subtrees. It is assumed that
-hyperedges that should be covered by the chi-set are labeled by -1.
-
-INPUT:	lambda: A separator (hyperedges) to be inserted into the lambda-set
-ChiConnect: Connector nodes that must be a subset of the chi-set
-Subtrees: Subtrees of the new hypertree-node
-OUTPUT: return: Labeled hypertree-node
-*/
-
-HypertreeSharedPtr Decomp::getHTNode(const HyperedgeVector &comp, const HyperedgeVector &lambda, const VertexSet &ChiConnect, const list<HypertreeSharedPtr> &Subtrees, const SuperedgeSharedPtr &Super) const
-{
-	HypertreeSharedPtr HTree = make_shared<Hypertree>(MyHg);
-	VertexSet vcomp;
-
-	for (auto &e : comp)
-		for (auto &v : e->allVertices())
-			vcomp.insert(v);
-
-
-	// Insert hyperedges and nodes into the hypertree-node
-	for (auto &e : lambda) {
-		HTree->insLambda(e);
-		for (auto &v : e->allVertices())
-			if (vcomp.find(v) != vcomp.end() && (Super == nullptr || Super->find(v) != nullptr))
-				HTree->insChi(v);
-	}
-
-	// Insert additional chi-labels to guarantee connectedness
-	for (auto &v : ChiConnect)
-		HTree->insChi(v);
-
-	// Insert children into the hypertree-node
-	for (auto &subtree : Subtrees)
-		//Super Edges are for the balanced separator algorithm
-		if (Super != nullptr) {
-			//cout << Super << " --- " << comp << endl;
-			HypertreeSharedPtr root = (subtree)->findNodeByLambda(Super);
-			if (root != nullptr) {
-				root->setRoot();
-				for (auto &child : root->allChildren())
-					HTree->insChild(child);
-				root->remChildren(false);
-			}
-			else
-				writeErrorMsg("Superedge not found in the subtree.", "BalKDecomp::getHTNode");
-		}
-		else
-			HTree->insChild(subtree);
-
-	return HTree;
-}
-
-HypertreeSharedPtr Decomp::getCutNode(int label, const HyperedgeVector & lambda, const VertexSet & ChiConnect) const
-{
-	HypertreeSharedPtr htree = getHTNode(lambda, lambda, ChiConnect);
-	htree->setCut();
-	htree->setLabel(label);
-	return htree;
-}
-
+#include <cmath>
+
+#include "Decomp.h"
+#include "Hyperedge.h"
+#include "Hypergraph.h"
+#include "Hypertree.h"
+#include "Superedge.h"
+#include "Separator.h"
+#include "DecompComponent.h"
+#include "SearchStats.h"
+#include "SearchContext.h"
+
+Decomp::~Decomp()
+{
+}
+
+/*
+***Description***
+The method changes the maximum width of the decomposition. Derived classes keep the results
+of earlier searches that are still valid for the new width.
+
+INPUT:	k: New maximum width
+*/
+
+void Decomp::setWidth(int k)
+{
+	if (k <= 0)
+		writeErrorMsg("Illegal hypertree-width.", "Decomp::setWidth");
+
+	MyK = k;
+}
+
+/*
+***Description***
+The method partitions a given set of hyperedges into connected components, i.e., into sets
+of hyperedges in the same component and sets of nodes connecting the components with the
+separator. 
+
+INPUT:	HEdges: Hyperedges to be partitioned
+OUTPUT: Partitions: Components consisting of sets of hyperedges
+Connectors: Sets of nodes connecting each component with the separator
+return: Number of components
+*/
+ 
+size_t Decomp::separate(const SeparatorSharedPtr &sep, const HyperedgeVector &edges, vector<DecompComponent> &partitions) const
+{
+	int label = 0;
+	const HypergraphCoreSharedPtr &core_ptr = MyHg->core();
+	const HypergraphCore &core = *core_ptr;
+	int idx;
+	SearchStats::ScopedTimer timer(SearchStats::Timer::Separate);
+
+	// Labels of the current thread; they are cleared in constant time, so the cost of a call
+	// does not depend on the size of the whole hypergraph
+	static thread_local unique_ptr<SearchContext> labels;
+	if (labels == nullptr || labels->core() != core_ptr)
+		labels = make_unique<SearchContext>(core_ptr);
+	SearchContext &ctx = *labels;
+	ctx.resetLabels(0);
+
+	partitions.clear();
+
+	//First set the label for all seperating vertices and edges
+	for (auto &e : sep->allEdges()) {
+		if ((idx = core.edgeIndex(e)) >= 0)
+			ctx.setEdgeLabel(idx, -1);
+		for (auto &v : e->allVertices())
+			if ((idx = core.vertexIndex(v)) >= 0)
+				ctx.setVertexLabel(idx, -1);
+	}
+
+	for (auto &he : edges) {
+		if ((idx = core.edgeIndex(he)) < 0)
+			writeErrorMsg("Hyperedge " + he->getName() + " is not part of the hypergraph.", "Decomp::separate");
+
+		if (ctx.edgeLabel(idx) == 0) {
+			DecompComponent comp(static_pointer_cast<BaseSeparator>(sep));
+			vector<uint> compEdges;
+			label++;
+
+			comp.add(he);
+			compEdges.push_back(idx);
+			ctx.setEdgeLabel(idx, label);
+			
+			//find all edges reachable from the current component
+			for (size_t i = 0; i < compEdges.size(); i++) {
+				for (auto v : core.edgeVertices(compEdges[i])) {
+					if (ctx.vertexLabel(v) == 0) {
+						ctx.setVertexLabel(v, label);
+						for (auto e : core.vertexEdges(v))
+							if (ctx.edgeLabel(e) == 0) {
+								ctx.setEdgeLabel(e, label);
+								compEdges.push_back(e);
+								comp.add(core.edge(e));
+							}
+					}
+				}
+			}
+
+			partitions.push_back(comp);
+		}
+	}
+
+	return partitions.size();
+}
+
+HypertreeSharedPtr Decomp::decompTrivial(const HyperedgeVector &edges, const VertexSet &connector) const
+{
+	HypertreeSharedPtr htree{ nullptr };
+	size_t total_weight = 0;
+
+	for (auto &e : edges)
+		total_weight += e->getWeight();
+	
+	// Stop if the hypergraph can be decomposed into a single hypertree-node
+	if (total_weight <= MyK)
+		return getHTNode(edges, edges, connector);
+
+	if (connector.size() == 0) {
+		// check if there are heavy edges (weight != cnt)
+		if (edges.size() == total_weight) {
+			// Stop if the hypergraph can be decomposed into two hypertree-nodes 
+			if ((edges.size() > 1) && ((int)ceil(edges.size() / 2.0) <= MyK)) {
+				HyperedgeVector part;
+				// The first node gets ceil(n/2) edges, the second one the remaining floor(n/2)
+				int half = ((int)edges.size() - 1) / 2;
+				int i = 0;
+				for (auto &he : edges) {
+					part.push_back(he);
+					if (i == half) {
+						htree = getHTNode(edges, part);
+						part.clear();
+					}
+					i++;
+				}
+
+				htree->insChild(getHTNode(edges, part));
+
+				return htree;
+			}
+		}
+		else {
+			// decompose in 2 hypertree nodes if possible
+			if (total_weight <= MyK * 2) {
+				HyperedgeVector part;
+				SuperedgeSharedPtr heavy{ nullptr };
+				// find the first heavy edge
+				for (auto it = edges.begin(); heavy == nullptr && it != edges.end(); it++)
+					if ((*it)->isHeavy())
+						heavy = dynamic_pointer_cast<Superedge>(*it);
+
+				// put all other edges into the first bag
+				for (auto &he : edges)
+					if (he != heavy) 
+						part.push_back(he);
+
+				
+				// create htree node
+				htree = getHTNode(edges, part);
+
+				// create second htree node
+				part.clear();
+				part.push_back(heavy);
+				htree->insChild(getHTNode(edges,part));
+
+				return htree;
+			}
+		}
+	}
+
+	
+
+	return htree;
+}
+
+
+/*
+***Description***
+The method creates a new hypertree-node, inserts the given hyperedges into the lambda-set,
+inserts the nodes of hyperedges labeled by -1 to the chi-set, inserts the nodes in
+ChiConnect to the chi-set, and adds the given hypertrees as subtrees. It is assumed that
+hyperedges that should be covered by the chi-set are labeled by -1.
+
+INPUT:	lambda: A separator (hyperedges) to be inserted into the lambda-set
+ChiConnect: Connector nodes that must be a subset of the chi-set
+Subtrees: Subtrees of the new hypertree-node
+Super: Superedge whose node replaces the root of each subtree (nullptr if none)
+OUTPUT: return: Labeled hypertree-node (nullptr if Super does not occur in some subtree)
+*/
+
+HypertreeSharedPtr Decomp::getHTNode(const HyperedgeVector &comp, const HyperedgeVector &lambda, const VertexSet &ChiConnect, const list<HypertreeSharedPtr> &Subtrees, const SuperedgeSharedPtr &Super) const
+{
+	HypertreeSharedPtr HTree = make_shared<Hypertree>(MyHg);
+	VertexSet vcomp;
+
+	for (auto &e : comp)
+		for (auto &v : e->allVertices())
+			vcomp.insert(v);
+
+
+	// Insert hyperedges and nodes into the hypertree-node
+	for (auto &e : lambda) {
+		HTree->insLambda(e);
+		for (auto &v : e->allVertices())
+			if (vcomp.find(v) != vcomp.end() && (Super == nullptr || Super->find(v) != nullptr))
+				HTree->insChi(v);
+	}
+
+	// Insert additional chi-labels to guarantee connectedness
+	for (auto &v : ChiConnect)
+		HTree->insChi(v);
+
+	// Insert children into the hypertree-node
+	for (auto &subtree : Subtrees)
+		//Super Edges are for the balanced separator algorithm
+		if (Super != nullptr) {
+			//cout << Super << " --- " << comp << endl;
+			HypertreeSharedPtr root = (subtree)->findNodeByLambda(Super);
+			if (root != nullptr) {
+				root->setRoot();
+				for (auto &child : root->allChildren())
+					HTree->insChild(child);
+				root->remChildren(false);
+			}
+			else
+				return nullptr;
+		}
+		else
+			HTree->insChild(subtree);
+
+	return HTree;
+}
+
+/*
+***Description***
+The method creates a hypertree-node that stands for a component whose decomposition is
+postponed (a cut node). The lambda-set holds the hyperedges of the component and the
+chi-set holds only the connector of the component. The chi-set must not be extended by the
+vertices of the component (as getHTNode would do), since expandHTree passes the chi-set of a
+cut node as connector when it decomposes the component again or looks it up in a cache;
+with the additional vertices, expansion fails for components that were cached before.
+
+INPUT:	label: Label of the cut node
+lambda: Hyperedges of the postponed component
+ChiConnect: Connector of the postponed component
+OUTPUT: return: Cut node
+*/
+
+HypertreeSharedPtr Decomp::getCutNode(int label, const HyperedgeVector & lambda, const VertexSet & ChiConnect) const
+{
+	HypertreeSharedPtr htree = make_shared<Hypertree>(MyHg);
+
+	// The chi-set only stores the connector such that the component can be expanded later
+	for (auto &e : lambda)
+		htree->insLambda(e);
+	for (auto &v : ChiConnect)
+		htree->insChi(v);
+	htree->setCut();
+	htree->setLabel(label);
+	return htree;
+}
+
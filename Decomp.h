@@ -4,6 +4,7 @@
 #if !defined(CLS_Decomp)
 #define CLS_Decomp
 
+#include <iostream>
 #include <list>
 
 #include "Globals.h"
@@ -11,6 +12,9 @@
 #include "Hypertree.h"
 #include "Separator.h"
 #include "DecompComponent.h"
+#include "SearchBudget.h"
+#include "SearchStats.h"
+#include "WorkStealingPool.h"
 
 class Decomp
 {
@@ -18,6 +22,28 @@ protected:
 	HypergraphSharedPtr MyHg;
 	int MyK;
 
+	// Budget of the search (nullptr if the search is unlimited)
+	SearchBudgetSharedPtr MyBudget;
+
+	// Heuristic for ordering the hyperedges before the search
+	EdgeOrder MyOrder{ EdgeOrder::MCS };
+
+	// Stream the progress of the search is written to
+	ostream *MyLog{ &cout };
+
+	// Charges the budget for a separator and counts it as enumerated; returns false if the
+	// search has to stop (the separator is then neither charged nor counted)
+	bool trySeparator() const {
+		if (MyBudget != nullptr && !MyBudget->trySeparator())
+			return false;
+		SearchStats::count(SearchStats::Counter::SepsEnumerated);
+		return true;
+	}
+
+	// Checks whether the search was cancelled or stopped by the budget; an interrupted
+	// search does not prove that a component is undecomposable
+	bool interrupted() const { return TaskGroup::cancelled() || (MyBudget != nullptr && MyBudget->exhausted()); }
+
 	// Separates a set of hyperedges into partitions with corresponding connecting nodes
 	size_t separate(const SeparatorSharedPtr &sep, const HyperedgeVector &edges, vector<DecompComponent> &partitions) const;
 
@@ -33,7 +59,7 @@ protected:
 	}
 
 
-	// Creates a hypertree cutnode
+	// Creates a hypertree cutnode whose chi-set holds only the connector of the component
 	HypertreeSharedPtr getCutNode(int label, const HyperedgeVector &lambda, const VertexSet &ChiConnect = VertexSet()) const;
 	HypertreeSharedPtr getCutNode(int label, const DecompComponent &decomp) const {
 		return getCutNode(label, decomp.component(), decomp.connector());
@@ -51,6 +77,22 @@ public:
 
 	// Constructs a hypertree decomposition of width at most MyK (if it exists)
 	virtual HypertreeSharedPtr buildHypertree() = 0;
+
+	// Constructs a hypertree decomposition of width at most MyK whose root covers the given
+	// vertices; the default implementation ignores the vertices
+	virtual HypertreeSharedPtr buildRootedHypertree(const VertexSet &Root) { return buildHypertree(); }
+
+	// Changes the maximum width of the decomposition for subsequent calls of buildHypertree
+	virtual void setWidth(int k);
+
+	// Limits the search by a budget (nullptr for an unlimited search)
+	void setBudget(const SearchBudgetSharedPtr &budget) { MyBudget = budget; }
+
+	// Selects the heuristic for ordering the hyperedges
+	void setEdgeOrder(EdgeOrder Order) { MyOrder = Order; }
+
+	// Writes the progress of the search to the given stream instead of the standard output
+	void setLog(ostream &Log) { MyLog = &Log; }
 };
 
 #endif
@@ -1,37 +1,83 @@
-#include "DecompComponent.h"
-#include "Hyperedge.h"
-
-
-DecompComponent::~DecompComponent()
-{
-}
-
-void DecompComponent::add(const HyperedgeSharedPtr & edge)
-{
-	if (!contains(edge)) {
-		for (const auto v : edge->allVertices())
-			if (MySep->contains(v))
-				MyConnector.insert(v);
-		MyComp.push_back(edge);
-	}
-}
-
-HyperedgeSharedPtr DecompComponent::containsOneOf(const list<HyperedgeSharedPtr>& edges) const
-{
-	for (auto &e : edges)
-		if (contains(e))
-			return e;
-
-	return nullptr;
-}
-
-void DecompComponent::label(int label, int sepLabel) const
-{
-	for (auto e : MyComp) 
-		e->setAllLabels(label);
-
-	for (auto v : MyConnector) 
-		v->setLabel(sepLabel);
-
-	MySep->label(sepLabel);
-}
+#include <algorithm>
+
+#include "DecompComponent.h"
+#include "Hyperedge.h"
+
+
+// Scrambles an ID such that the sum of scrambled IDs is a good order-independent hash
+static size_t mixId(uint id)
+{
+	size_t x = (size_t)id + 0x9e3779b97f4a7c15ULL;
+	x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+	return x ^ (x >> 31);
+}
+
+
+DecompComponent::~DecompComponent()
+{
+}
+
+void DecompComponent::add(const HyperedgeSharedPtr & edge)
+{
+	const HypergraphCore &core = *MySep->core();
+	int idx = core.edgeIndex(edge);
+
+	// The connector consists of the vertices of the component covered by the separator
+	if (idx >= 0 && core.edge(idx) == edge) {
+		for (auto v : core.edgeVertices(idx))
+			if (MySep->coveredVertices().test(v) && MyConnector.insert(core.vertex(v)).second)
+				MyConnectorHash += mixId(core.vertex(v)->getId());
+	}
+	else {
+		// Edges outside the core (e.g., subedges) are handled by their vertices
+		for (const auto v : edge->allVertices())
+			if (MySep->contains(v) && MyConnector.insert(v).second)
+				MyConnectorHash += mixId(v->getId());
+	}
+
+	MyComp.push_back(edge);
+	MyEdgeHash += mixId(edge->getId());
+}
+
+CompFingerprint DecompComponent::fingerprint() const
+{
+	CompFingerprint fp;
+
+	fp.hash = MyEdgeHash ^ (MyConnectorHash * 31);
+
+	fp.edges.reserve(MyComp.size());
+	for (auto &e : MyComp)
+		fp.edges.push_back(e->getId());
+	sort(fp.edges.begin(), fp.edges.end());
+
+	fp.connector.reserve(MyConnector.size());
+	for (auto &v : MyConnector)
+		fp.connector.push_back(v->getId());
+	sort(fp.connector.begin(), fp.connector.end());
+
+	return fp;
+}
+
+CompFingerprint DecompComponent::fingerprint(const HyperedgeSet &Edges, const VertexSet &Connector)
+{
+	CompFingerprint fp;
+	size_t edge_hash{ 0 }, connector_hash{ 0 };
+
+	fp.edges.reserve(Edges.size());
+	for (auto &e : Edges) {
+		fp.edges.push_back(e->getId());
+		edge_hash += mixId(e->getId());
+	}
+	sort(fp.edges.begin(), fp.edges.end());
+
+	fp.connector.reserve(Connector.size());
+	for (auto &v : Connector) {
+		fp.connector.push_back(v->getId());
+		connector_hash += mixId(v->getId());
+	}
+	sort(fp.connector.begin(), fp.connector.end());
+
+	fp.hash = edge_hash ^ (connector_hash * 31);
+	return fp;
+}
@@ -1,39 +1,71 @@
-#if !defined(CLS_DECOMPCOMP)
-#define CLS_DECOMPCOMP
-
-#include <list>
-
-#include "Hypergraph.h"
-#include "BaseSeparator.h"
-
-#pragma once
-class DecompComponent
-{
-	HyperedgeVector MyComp;
-	VertexSet MyConnector;
-	BaseSeparatorSharedPtr MySep;
-
-public:
-	DecompComponent(const BaseSeparatorSharedPtr &sep) : MySep{ sep } {};
-	DecompComponent() {};
-	~DecompComponent();
-
-	void add(const HyperedgeSharedPtr &edge);
-	auto size() const { return MyComp.size(); }
-
-	bool contains(const HyperedgeSharedPtr &edge) const { return find(MyComp.begin(),MyComp.end(),edge) != MyComp.end(); }
-	HyperedgeSharedPtr containsOneOf(const list<HyperedgeSharedPtr> &edges) const;
-	
-	// Labels the component with label and the seperator and connector with -1
-	void label(int label, int sepLabel = -1) const;
-
-	HyperedgeSharedPtr first() const { if (MyComp.size() > 0) return *(MyComp.begin()); else return HyperedgeSharedPtr(nullptr); }
-
-	const HyperedgeVector &component() const { return MyComp; }
-	const VertexSet &connector() const { return MyConnector; }
-
-	HyperedgeSharedPtr& operator[](std::size_t idx) { return MyComp[idx]; }
-	const HyperedgeSharedPtr& operator[](std::size_t idx) const { return MyComp[idx]; }
-};
-
+#if !defined(CLS_DECOMPCOMP)
+#define CLS_DECOMPCOMP
+
+#include <algorithm>
+#include <list>
+#include <vector>
+#include <unordered_set>
+
+#include "Hypergraph.h"
+#include "BaseSeparator.h"
+
+// Order-independent fingerprint of a component given by its edges and its connector
+struct CompFingerprint {
+	// Combined hash value of the edge IDs and the connector vertex IDs
+	size_t hash{ 0 };
+	// Sorted IDs of the edges in the component
+	vector<uint> edges;
+	// Sorted IDs of the connector vertices
+	vector<uint> connector;
+
+	bool operator==(const CompFingerprint &other) const {
+		return hash == other.hash && edges == other.edges && connector == other.connector;
+	}
+};
+
+struct CompFingerprintHash {
+	size_t operator() (const CompFingerprint &fp) const {
+		return fp.hash;
+	}
+};
+
+using CompFingerprintSet = unordered_set<CompFingerprint, CompFingerprintHash>;
+
+#pragma once
+class DecompComponent
+{
+	HyperedgeVector MyComp;
+	VertexSet MyConnector;
+	BaseSeparatorSharedPtr MySep;
+
+	// Order-independent hash values of the edge IDs and connector IDs added so far
+	size_t MyEdgeHash{ 0 };
+	size_t MyConnectorHash{ 0 };
+
+public:
+	DecompComponent(const BaseSeparatorSharedPtr &sep) : MySep{ sep } {};
+	DecompComponent() {};
+	~DecompComponent();
+
+	// Adds an edge that is not part of the component yet (separate() labels the edges it adds)
+	void add(const HyperedgeSharedPtr &edge);
+	auto size() const { return MyComp.size(); }
+
+	bool contains(const HyperedgeSharedPtr &edge) const { return find(MyComp.begin(), MyComp.end(), edge) != MyComp.end(); }
+
+	// Returns the fingerprint identifying this component in a component cache
+	CompFingerprint fingerprint() const;
+
+	// Returns the fingerprint of the component with the given edges and connector
+	static CompFingerprint fingerprint(const HyperedgeSet &Edges, const VertexSet &Connector);
+	
+	HyperedgeSharedPtr first() const { if (MyComp.size() > 0) return *(MyComp.begin()); else return HyperedgeSharedPtr(nullptr); }
+
+	const HyperedgeVector &component() const { return MyComp; }
+	const VertexSet &connector() const { return MyConnector; }
+
+	HyperedgeSharedPtr& operator[](std::size_t idx) { return MyComp[idx]; }
+	const HyperedgeSharedPtr& operator[](std::size_t idx) const { return MyComp[idx]; }
+};
+
 #endif
\ No newline at end of file
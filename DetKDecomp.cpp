@@ -1,791 +1,1112 @@
-// DetKDecomp.cpp: implementation of the DetKDecomp class.
-//
-//////////////////////////////////////////////////////////////////////
-
-
-#include <cstdio>
-#include <iostream>
-#include <cmath>
-#include <algorithm>
-
-#include <list>
-#include <vector>
-
-using namespace std;
-
-#include "DetKDecomp.h"
-#include "Hypertree.h"
-#include "Hypergraph.h"
-#include "Hyperedge.h"
-#include "Vertex.h"
-#include "Globals.h"
-#include "Subedges.h"
-#include "SubedgeSeparatorFactory.h"
-#include "DecompComponent.h"
-
-
-//////////////////////////////////////////////////////////////////////
-// Construction/Destruction
-//////////////////////////////////////////////////////////////////////
-
-
-DetKDecomp::DetKDecomp(const HypergraphSharedPtr &HGraph, int k, bool bip) : Decomp(HGraph, k), MyBIP{ bip }
-{
-	if (MyBIP)
-		MySubedges = make_unique<Subedges>(HGraph, k);
-}
-
-
-DetKDecomp::~DetKDecomp()
-{
-}
-
-
-
-//////////////////////////////////////////////////////////////////////
-// Class methods
-//////////////////////////////////////////////////////////////////////
-
-
-/*
-***Description***
-The method selects an initial subset within a set of hyperedges such that a given set of 
-nodes is covered.
-
-INPUT:	Nodes: Array of nodes to be covered
-		Edges: Array of hyperedges
-		bInComp: Boolean array indicating the position of each hyperedge
-		iSize: Number of elements in Edges, bInComp, and CovWeights
-OUTPUT: Set: Selection of hyperedges in Edges such that all nodes in Nodes are covered
-		CovWeights: Array with the number of connector nodes covered by each hyperedge
-		return: Number of selected hyperedges; -1 if nodes cannot be covered
-*/
-
-int DetKDecomp::setInitSubset(const VertexSet &Vertices, HyperedgeVector &Edges, vector<int> &Set, vector<bool> &InComp, vector<int> &CovWeights) const
-{
-	int uncov{ (int)Vertices.size() };
-	int weight, e;
-
-	// Reset node labels
-	MyHg->setVertexLabels(-1);
-	for(auto v : Vertices)
-		v->setLabel(0);
-
-	// Sort hyperedges according to their weight,
-	// i.e., the number of nodes in Nodes they contain
-	e = 0;
-	for(auto he : Edges) {
-		he->setLabel((int)InComp[e]);
-		CovWeights[e] = 0;
-		for(auto v : he->allVertices())
-			if(v->getLabel() == 0)
-				--CovWeights[e];
-		e++;
-	}
-
-	sortVectors<HyperedgeSharedPtr>(Edges, CovWeights, 0, (int)Edges.size()-1);
-
-	// Reset bInComp and summarize weights
-	for(int i=0; i < (int)Edges.size(); i++) {
-		Edges[i]->getLabel() == 0 ? InComp[i] = false : InComp[i] = true;
-		CovWeights[i] = -CovWeights[i];
-	}
-	weight = 0;
-	for(int i=(int)Edges.size()-1; i >= 0; i--) {
-		weight += CovWeights[i];
-		CovWeights[i] = weight;
-	}
-
-	// Select an initial subset of at most iMyK hyperedges
-	return coverNodes(Edges, Set, InComp, CovWeights, uncov, false);
-}
-
-
-/*
-***Description***
-The method selects the next subset within a set of hyperedges such that a given set of 
-nodes is covered.
-
-INPUT:	Nodes: Array of nodes to be covered
-		Edges: Array of hyperedges
-		Set: Integer array of indices in Edges representing a subset selection
-		bInComp: Boolean array indicating the position of each hyperedge
-		CovWeights: Array with the number of connector nodes covered by each hyperedge
-		iSize: Number of elements in Edges, bInComp, and CovWeights
-OUTPUT: Set: Selection of hyperedges in Edges such that all nodes in Nodes are covered
-		return: Number of selected hyperedges; -1 if there is no alternative selection
-*/
-
-int DetKDecomp::setNextSubset(const VertexSet &Vertices, HyperedgeVector &Edges, vector<int> &Set, vector<bool> &InComp, vector<int> &CovWeights) const
-{
-	MyHg->setVertexLabels(-1);
-	for(auto v : Vertices)
-		v->setLabel(0);
-
-	// Select the next subset of at most iMyK hyperedges
-	return coverNodes(Edges, Set, InComp, CovWeights, Vertices.size(), true);
-}
-
-
-int DetKDecomp::coverNodes(HyperedgeVector &Edges, vector<int> &Set, vector<bool> &InComp, vector<int> &CovWeights, size_t Uncovered, bool Reconstr) const
-{
-	int i;
-
-	int pos, nbr_sel, in_comp_sel, weight;
-	int size{ (int)Edges.size() };
-	bool covered, back, select;
-	list<vector<int>> label_stack;
-	list<int *>::iterator ListIter;
-	vector<int> tmp_labels;
-
-	pos = nbr_sel = in_comp_sel = 0;
-	Uncovered == 0 ? covered = true : covered = false;
-
-	// Reconstruct the search tree according to Set
-	if (Reconstr) {
-		if (Set[0] == -1) return -1;
-
-		for (nbr_sel = 0; Set[nbr_sel + 1] != -1; nbr_sel++) {
-			pos = Set[nbr_sel];
-			if (InComp[pos])
-				++in_comp_sel;
-
-			tmp_labels.clear();
-			tmp_labels.resize(Edges[pos]->getNbrOfVertices());
-			//if(iTmpLabels == NULL)
-			//	writeErrorMsg("Error assigning memory.", "DetKDecomp::coverNodes");
-
-			// Save labels of nodes in the actual hyperedge and label these nodes by 1
-			i = 0;
-			for (auto v : Edges[pos]->allVertices()) {
-				tmp_labels[i] = v->getLabel();
-				v->setLabel(1);
-				i++;
-			}
-
-			label_stack.push_back(tmp_labels);
-		}
-
-		pos = Set[nbr_sel];
-		Uncovered = 0;
-		for (auto v : Edges[pos]->allVertices())
-			if(v->getLabel() == 0)
-				++Uncovered;
-		++pos;
-	}
-
-	// Search for a new set of covering hyperedges
-	while(!covered) {
-		for(back=false; !covered; pos++) { 
-
-			// Check if nodes can be covered by the remaining hyperedges;
-			// prune the search tree if not
-			i = pos + (MyK-nbr_sel);
-			if(i < size)
-				weight = CovWeights[pos] - CovWeights[i];
-			else
-				if(pos < size)
-					weight = CovWeights[pos];
-				else
-					weight = 0;
-			if((weight < Uncovered) || (weight == 0)) {
-				back = true;
-				break;
-			}
-
-			// Check if the actual hyperedge covers some uncovered node
-			select = false;
-			if(InComp[pos] || (in_comp_sel > 0) || (nbr_sel < MyK-1))
-				for(auto v : Edges[pos]->allVertices())
-					if(v->getLabel() == 0) {
-						select = true;
-						break;
-					}
-
-			if (select) {
-				// Select the actual hyperedge
-				Set[nbr_sel++] = pos;
-				if (InComp[pos])
-					++in_comp_sel;
-
-				tmp_labels.clear();
-				tmp_labels.resize(Edges[pos]->getNbrOfVertices());
-
-				//iTmpLabels = new int[Edges[iPos]->getNbrOfNodes()];
-				//if(iTmpLabels == NULL)
-				//	writeErrorMsg("Error assigning memory.", "DetKDecomp::coverNodes");
-
-				// Save labels of nodes in the actual hyperedge and label these nodes by 1
-				i = 0;
-				for (auto v : Edges[pos]->allVertices()) {
-					tmp_labels[i] = v->getLabel();
-					v->setLabel(1);
-					if(tmp_labels[i] == 0)
-						--Uncovered;
-					i++;
-				}
-				label_stack.push_back(tmp_labels);
-
-				// Check whether all nodes are covered
-				if(Uncovered == 0)
-					covered = true;
-			}
-		}
-
-		if(back) {
-			if(nbr_sel == 0) {
-				// No more possibilities to cover the nodes
-				nbr_sel = -1;
-				break;
-			}
-			else {
-				// Undo the last selection if the nodes cannot be covered in this way
-				pos = Set[--nbr_sel];
-				if (InComp[pos])
-					--in_comp_sel;
-
-				tmp_labels = label_stack.back();
-				label_stack.pop_back();
-
-				i = 0;
-				for (auto v : Edges[pos]->allVertices()) {
-					v->setLabel(tmp_labels[i]);
-					if(tmp_labels[i] == 0)
-						++Uncovered;
-					i++;
-				}
-				//delete [] iTmpLabels;
-				++pos;
-			}
-		}
-	}
-
-	if(nbr_sel >= 0)
-		Set[nbr_sel] = -1;
-
-	//for(ListIter=LabelStack.begin(); ListIter != LabelStack.end(); ListIter++)
-	//	delete [] *ListIter;
-
-	return nbr_sel;
-}
-
-/*
-***Description***
-The method divides a given set of hyperedges into inner hyperedges and its boundary according
-to a given set of boundary nodes. The inner hyperedges are those not containing a boundary node.
-All other hyperedges containing a boundary node (within the given set or outside) belong to
-the boundary hyperedges.
-
-INPUT:	HEdges: Hyperedges
-		Nodes: Boundary nodes
-OUTPUT: Inner: Inner hyperedges not containing a boundary node
-		Bound: Boundary hyperedges containing a boundary node
-		return: Index in Bound that separates boundary hyperedges within and outside the given 
-		set of hyperedges; all hyperedges before this index are inside the given set and all
-		hyperedges starting at this index are outside the given set.
-*/
-
-size_t DetKDecomp::divideCompEdges(const HyperedgeVector &HEdges, const VertexSet &Vertices, HyperedgeVector &Inner, HyperedgeVector &Bound) const
-{
-	bool covered;
-	size_t cnt_edges{ HEdges.size() };
-	list<HyperedgeSharedPtr> innerb, outerb;
-	unordered_map<HyperedgeSharedPtr, int> edgeLabels;
-	unordered_map<VertexSharedPtr, int> vertexLabels;
-	
-	for (auto he : HEdges)
-		edgeLabels[he] = 1;
-
-	// Compute the hyperedges containing a boundary node and store them
-	// in InnerB if they are contained in the given set and in OuterB otherwise
-	for(auto v : Vertices)
-		for(auto he : MyHg->allVertexNeighbors(v)) {
-			// Only use normal edges for separators
-			if (!he->isHeavy()) {
-				switch (edgeLabels[he]) {
-				case 0:	// Hyperedge is not contained in HEdges
-					edgeLabels[he]  = -1;
-					outerb.push_back(he);
-					break;
-				case 1:	// Hyperedge is contained in HEdges
-					edgeLabels[he] = -1;
-					innerb.push_back(he);
-					break;
-				}
-			}
-		}
-
-	// Store hyperedges not containing a boundary node in the array
-	for (auto he : HEdges)
-		if (edgeLabels[he] > 0)
-			Inner.push_back(he);
-
-	edgeLabels.clear();
-	for(auto he : outerb)
-		edgeLabels[he] = 1;
-
-	
-
-	// Remove redundant hyperedges from OuterB; such a hyperedge is redundant if the set of its
-	// boundary nodes is covered by some other hyperedge in OuterB
-	for(auto it=outerb.begin(); it != outerb.end(); it++) {
-		// Label all boundary nodes by 1
-		for (auto v : Vertices)
-			vertexLabels[v] = (1);
-
-		// Reset the labels of all nodes of the actual hyperedge in OuterB
-		for(auto v : (*it)->allVertices())
-			vertexLabels[v] = 0;
-
-		// Check whether some hyperedge in OuterB in the neighbourhood of the actual hyperedge
-		// contains no node labeled with 1; in this case it can be removed from OuterB since its 
-		// boundery nodes are covered by the actual hyperedge in OuterB
-		for(auto he : MyHg->allEdgeNeighbors(*it))
-			if(edgeLabels[he] != 0) {
-				covered = true;
-				for(auto v : he->allVertices())
-					if (vertexLabels[v] != 0) {
-						covered = false;
-						break;
-					}
-				if(covered)
-					outerb.remove(he);
-			}
-	}
-
-	// Store hyperedges containing a boundary node in the array
-	for(auto he : innerb)
-		Bound.push_back(he);
-	for(auto he : outerb)
-		Bound.push_back(he);
-
-	return innerb.size();
-}
-
-CompCache & DetKDecomp::getSepParts(SeparatorSharedPtr & sep) const
-{
-	for (auto t : MyTriedSeps)
-		if (t.first == sep) {
-			sep = t.first;
-			break;
-		}
-	
-	return MyTriedSeps[sep];
-}
-
-
-/*
-***Description***
-The method checks whether the actual separator occurs in the MySeps list of already
-used separators. If so, the method returns two lists of hyperedges identifiying the 
-decomposable and undecomposable partitions. It is assumed that separator hyperedges 
-are labeled by -1 and no other hyperedges are labeled by -1.
-
-INPUT:	iSepSize: Size of the actual separator
-OUTPUT: Separator: Stored separator
-		SuccParts: List of decomposable partitions
-		FailParts: List of undecomposable partitions
-		return: true if separator was found; otherwise false
-*/
-/*
-bool DetKDecomp::getSepParts(int SepSize, HE_VEC **Separator, list<Hyperedge *> **SuccParts, list<Hyperedge *> **FailParts)
-{
-	int i;
-	bool found = false;
-	list<list<Hyperedge *> *>::iterator SuccPartIter, FailPartIter;
-
-	// Check whether the actual separator is known to be decomposable or undecomposable
-	SuccPartIter = MySuccSepParts.begin();
-	FailPartIter = MyFailSepParts.begin();
-	for(auto sep : MySeps) {
-		found = true;
-		i = 0;
-		for (auto he : *sep) {
-			if (he->getLabel() != -1) {
-				found = false;
-				break;
-			}
-			i++;
-		}
-
-		if(found && (i == SepSize)) {
-			*Separator = sep;
-			*SuccParts = *SuccPartIter;
-			*FailParts = *FailPartIter;
-			return true;
-		}
-
-		++SuccPartIter;
-		++FailPartIter;
-	}
-
-	return false;
-}
-*/
-
-/*
-***Description***
-The method searches in a list of hyperedges for an edge with a given label.
-
-INPUT:	HEdges: Pointer to a list of hyperedges
-		iLabel: Label
-OUTPUT: return: true if there exists an edge in HEdges labeled by iLabel; otherwise false
-*/
-
-bool DetKDecomp::containsLabel(list<Hyperedge *> *HEdges, int iLabel)
-{
-	list<Hyperedge *>::iterator ListIter;
-
-	// Search for a hyperedge labeled by iLabel
-	for(ListIter=HEdges->begin(); ListIter != HEdges->end(); ListIter++)
-		if((*ListIter)->getLabel() == iLabel)
-			return true;
-
-	return false;
-}
-
-
-/*
-***Description***
-The method decomposes the hyperedges in a subhypergraph as described in Gottlob and 
-Samer: A Backtracking-Based Algorithm for Computing Hypertree-Decompositions.
-
-INPUT:	HEdges: Hyperedges in the subgraph
-		Connector: Connector nodes that must be covered
-		iRecLevel: Recursion level
-OUTPUT: return: Hypertree decomposition of HEdges
-*/
-bool DetKDecomp::covers(const HyperedgeVector &Edges, const VertexSet &Vertices) const
-{
-	bool found;
-
-	for (auto v : Vertices) {
-		found = false;
-		for (auto e : Edges) {
-			if (e->find(v) != nullptr) {
-				found = true;
-				break;
-			}
-		}
-
-		if (!found)
-			return false;
-	}
-		
-	return true;
-}
-
-HypertreeSharedPtr DetKDecomp::decomp(const HyperedgeVector &HEdges, const VertexSet &Connector, int RecLevel) const
-{
-	int i, j;
-	
-	list<Hypertree *>::iterator TreeIter;
-	
-	SeparatorSharedPtr separator{ nullptr };
-	vector<int> cov_sep_set, cov_weights;
-	vector<bool> in_comp;
-	size_t cnt_edges{ HEdges.size() };
-	int comp_end, nbr_sel_cov, i_add, sep_size;
-	size_t nbr_of_parts;
-	bool add_edge, fail_sep, sub_edge;
-    HypertreeSharedPtr htree{ nullptr };
-
-	HyperedgeVector inner_edges, bound_edges, add_edges;
-
-	/*
-	for (int k = 0; k <= RecLevel; k++)
-		cout << "+";
-	cout << " " << *HEdges << endl;
-	*/
-
-	if ((htree = decompTrivial(HEdges, Connector)) != nullptr)
-		return htree;	
-
-	// Divide hyperedges into inner hyperedges and hyperedges containing some connecting nodes
-	comp_end = (int)divideCompEdges(HEdges, Connector, inner_edges, bound_edges);
-
-	in_comp.resize(bound_edges.size());
-	cov_weights.resize(bound_edges.size(),0);
-	cov_sep_set.resize(MyK+1);
-	for(i=0; i < bound_edges.size(); i++)
-		i < comp_end ? in_comp[i] = true : in_comp[i] = false;
-
-	// Select initial hyperedges to cover the connecting nodes
-	nbr_sel_cov = setInitSubset(Connector, bound_edges, cov_sep_set, in_comp, cov_weights);
-
-	// Initialize AddEdges array
-	for (i = 0; i < bound_edges.size(); i++)
-		if (in_comp[i])
-			if (!bound_edges[i]->isHeavy())
-				add_edges.push_back(bound_edges[i]);
-	for (i = 0; i < inner_edges.size(); i++)
-		if (!inner_edges[i]->isHeavy())
-			add_edges.push_back(inner_edges[i]);
-	if(add_edges.size() <= 0)
-		writeErrorMsg("Illegal number of hyperedges.", "DetKDecomp::decomp");
-
-	if(nbr_sel_cov >= 0)
-		do {
-			// Check whether a covering hyperedge within the component was selected
-			add_edge = true;
-			for(i=0; i < nbr_sel_cov; i++)
-				if(in_comp[cov_sep_set[i]]) {
-					add_edge = false;
-					break;
-				}
-
-			// Stop if no inner hyperedge can be in the separator
-			if(!add_edge || (MyK-nbr_sel_cov > 0)) {
-
-				i_add = 0;
-				add_edge ? sep_size = nbr_sel_cov+1 : sep_size = nbr_sel_cov;
-
-				do {
-
-					sub_edge = false;
-					// Output the search progress
-					// cout << "(" << RecLevel << ")" << endl;
-
-					// Create a separator 
-					separator = make_shared<Separator>();
-
-					for(i=0; i < nbr_sel_cov; i++) 
-						separator->insert(bound_edges[cov_sep_set[i]]);
-					
-					if (add_edge)
-						separator->insert(add_edges[i_add]);
-
-					SubedgeSeparatorFactory sub_sep_fac;
-
-					do {
-						// Check if selected hyperedges were already used before as separator
-						auto &reused = getSepParts(separator);
-
-						/*
-						if (!reused_sep) {
-							// Create a separator array and lists for decomposable and undecomposable parts
-							// keep sub_separator if built from a subedge separator
-							if (sub_edge) {
-								separator = sub_separator;
-							}
-							else {
-								separator = new HE_VEC(sep_size, nullptr);
-								if (separator == nullptr)
-									writeErrorMsg("Error assigning memory.", "DetKDecomp::decomp");
-
-								// Store separating hyperedges in the separator array
-								for (i = 0; i < nbr_sel_cov; i++)
-									(*separator)[i] = bound_edges[cov_sep_set[i]];
-								if (add_edge)
-									(*separator)[i++] = add_edges[i_add];
-							}
-
-							succ_parts = new list<Hyperedge *>;
-							fail_parts = new list<Hyperedge *>;
-							if ((succ_parts == nullptr) || (fail_parts == nullptr))
-								writeErrorMsg("Error assigning memory.", "DetKDecomp::decomp");
-
-							
-							//Separator[i] = NULL;
-
-							MySeps.push_back(separator);
-							MySuccSepParts.push_back(succ_parts);
-							MyFailSepParts.push_back(fail_parts);
-						}
-						else
-							if (sub_edge)
-								delete sub_separator;
-
-						//Debugging output
-						/*
-						cout << "+++ Separator: ";
-						for (int i = 0; i < separator->size(); i++) {
-							cout << (*separator)[i]->getName();
-							if (i < separator->size()-1)
-								cout << ",";
-						}
-						cout << endl;
-						*/
-
-						vector<DecompComponent> partitions;
-						vector<bool> cut_parts;
-						list<HypertreeSharedPtr> Subtrees;
-
-						// Separate hyperedges into partitions with corresponding connector nodes
-						nbr_of_parts = separate(separator, HEdges, partitions);
-
-						// Create auxiliary array
-						cut_parts.clear();
-						cut_parts.resize(nbr_of_parts);
-
-						// Check partitions for decomposibility and undecomposibility
-						fail_sep = false;
-						for (i = 0; i < partitions.size(); i++) {
-							if (partitions[i].size() >= cnt_edges) {
-								//writeErrorMsg("Monotonicity violated.", "DetKDecomp::decomp");
-								fail_sep = true;
-								reused.failed.push_back(partitions[i].first());
-								break;
-							}
-
-							// Check for undecomposability
-							if (partitions[i].containsOneOf(reused.failed)) {
-								fail_sep = true;
-								break;
-							}
-
-							// Check for decomposibility
-							if (partitions[i].containsOneOf(reused.succ))
-								cut_parts[i] = true;
-							else
-								cut_parts[i] = false;
-						}
-
-						if (!fail_sep) {
-							// Decompose partitions into hypertrees
-							for (i = 0; i < partitions.size(); i++) {
-								if (cut_parts[i]) {
-									// Prune subtree
-									htree = getCutNode(RecLevel + 1, partitions[i]);
-								}
-								else {
-									// Decompose component recursively
-									htree = decomp(partitions[i], RecLevel + 1);
-									if (htree == nullptr)
-										reused.failed.push_back(partitions[i][0]);
-									else
-										reused.succ.push_back(partitions[i][0]);
-								}
-
-								if (htree != nullptr)
-									Subtrees.push_back(htree);
-								else break;
-							}
-
-							//Either all components decomposed or some component failed
-							if (htree != nullptr) {
-								// Create a new hypertree node
-								if (sub_edge) {
-									for (auto he : *separator)
-										he->setLabel(-1);
-								}
-								else {
-									for (i = 0; i < nbr_sel_cov; i++) {
-										j = cov_sep_set[i];
-										in_comp[j] ? bound_edges[j]->setLabel(-1) : bound_edges[j]->setLabel(0);
-									}
-									if (add_edge)
-										add_edges[i_add]->setLabel(-1);
-								}
-								htree = getHTNode(HEdges, separator, Connector, Subtrees);
-							}
-						}
-
-						if (MyBIP && htree == nullptr) {
-							//Start sub_edge procedure
-							if (!sub_edge) {
-								sub_edge = true;
-								sub_sep_fac.init(MyHg, HEdges, separator, MySubedges);
-							}
-
-							bool found = false;
-							while (!found && (separator = sub_sep_fac.next())->size() != 0) {
-								found = true;
-								//Check if new sub_separator still covers all connector nodes
-								if (!covers(separator, Connector))
-									found = false;
-							} 
-
-							// All subedge separators tried
-							if (separator->size() == 0)
-								sub_edge = false;
-						}
-
-					} while (MyBIP && sub_edge && htree == nullptr);
-					
-				} while(add_edge && (htree == nullptr) && (++i_add < add_edges.size()));
-			}
-
-		} while((htree == nullptr) && ((nbr_sel_cov = setNextSubset(Connector, bound_edges, cov_sep_set, in_comp, cov_weights)) > 0));
-
-	return htree;
-}
-
-
-/*
-***Description***
-The method expands pruned hypertree nodes, i.e., subgraphs which were not decomposed but are
-known to be decomposable are decomposed.
-
-INPUT:	HTree: Hypertree that has to be expanded
-OUTPUT: HTree: Expanded hypertree
-*/
-
-void DetKDecomp::expandHTree(HypertreeSharedPtr &HTree)
-{
-	HypertreeSharedPtr cut_node, subtree;
-	
-	while((cut_node = HTree->getCutNode()) != nullptr) {
-
-		// Store subgraph in an array
-		auto &lambda = cut_node->getLambda();
-		HyperedgeVector edges(lambda.begin(), lambda.end());
-
-		// Store connector nodes in an array
-		auto &chi = cut_node->getChi();
-		VertexSet connector(chi);
-
-		// Reconstruct parent separator
-		auto parent = cut_node->getParent().lock();
-		auto &parent_lambda = parent->getLambda();
-		Separator parent_sep(HyperedgeVector(parent_lambda.begin(),parent_lambda.end()));
-		
-				// Decompose subgraph
-		subtree = decomp(edges, connector, cut_node->getLabel());
-		if(subtree == nullptr)
-			writeErrorMsg("Illegal decomposition pruning.", "H_DetKDecomp::expandHTree");
-
-		// Replace the pruned node by the corresponding subtree
-		parent->insChild(subtree);
-		parent->remChild(cut_node);
-
-	}
-}
-
-
-/*
-***Description***
-The method builds a hypertree decomposition of a given hypergraph as described in Gottlob 
-and Samer: A Backtracking-Based Algorithm for Computing Hypertree-Decompositions.
-
-INPUT:	iK: Maximum separator size
-OUTPUT: return: Hypertree decomposition of HGraph
-*/
-
-HypertreeSharedPtr DetKDecomp::buildHypertree()
-{
-	HypertreeSharedPtr HTree;
-	HyperedgeVector HEdges;
-
-	// Order hyperedges heuristically
-	HEdges = MyHg->getMCSOrder();
-
-     	//cout << HEdges << endl;
-
-	// Store initial heuristic order as weight
-	//for(int i=0; i < HEdges.size(); i++)
-	//	HEdges[i]->setWeight(i);
-
-	// Build hypertree decomposition
-	HTree = decomp(HEdges);
-
-	// Expand pruned hypertree nodes
-	if((HTree != nullptr) && (HTree->getCutNode() != nullptr)) {
-		cout << "Expanding hypertree ..." << endl;
-		expandHTree(HTree);
-	}
-
-	return HTree;
-}
-
-
+// DetKDecomp.cpp: implementation of the DetKDecomp class.
+//
+//////////////////////////////////////////////////////////////////////
+
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <cmath>
+#include <algorithm>
+
+#include <list>
+#include <vector>
+
+using namespace std;
+
+#include "DetKDecomp.h"
+#include "Hypertree.h"
+#include "Hypergraph.h"
+#include "Hyperedge.h"
+#include "Vertex.h"
+#include "Globals.h"
+#include "Subedges.h"
+#include "SubedgeSeparatorFactory.h"
+#include "DecompComponent.h"
+#include "SearchStats.h"
+#include "SearchTrace.h"
+
+
+//////////////////////////////////////////////////////////////////////
+// Construction/Destruction
+//////////////////////////////////////////////////////////////////////
+
+
+DetKDecomp::DetKDecomp(const HypergraphSharedPtr &HGraph, int k, bool bip) : Decomp(HGraph, k), MyContext{ HGraph->core() }, MyBIP{ bip }
+{
+	if (MyBIP)
+		MySubedges = make_unique<Subedges>(HGraph, k);
+}
+
+
+DetKDecomp::~DetKDecomp()
+{
+}
+
+
+
+//////////////////////////////////////////////////////////////////////
+// Class methods
+//////////////////////////////////////////////////////////////////////
+
+
+/*
+***Description***
+The method selects an initial subset within a set of hyperedges such that a given set of 
+nodes is covered.
+
+INPUT:	Nodes: Array of nodes to be covered
+		Edges: Array of hyperedges
+		bInComp: Boolean array indicating the position of each hyperedge
+		iSize: Number of elements in Edges, bInComp, and CovWeights
+OUTPUT: Set: Selection of hyperedges in Edges such that all nodes in Nodes are covered
+		CovWeights: Array with the number of connector nodes covered by each hyperedge
+		State: Selection state that is continued by setNextSubset
+		return: Number of selected hyperedges; -1 if nodes cannot be covered
+*/
+
+int DetKDecomp::setInitSubset(const VertexSet &Vertices, HyperedgeVector &Edges, vector<int> &Set, vector<bool> &InComp, vector<int> &CovWeights, CoverState &State) const
+{
+	SearchContext &ctx = context();
+	int weight, e, i;
+
+	// Reset node labels
+	ctx.resetVertexLabels(-1);
+	for(auto v : Vertices)
+		ctx.setLabel(v, 0);
+
+	// Sort hyperedges according to their weight,
+	// i.e., the number of nodes in Nodes they contain
+	e = 0;
+	for(auto he : Edges) {
+		ctx.setLabel(he, (int)InComp[e]);
+		CovWeights[e] = 0;
+		for(auto v : he->allVertices())
+			if(ctx.label(v) == 0)
+				--CovWeights[e];
+		e++;
+	}
+
+	sortVectors<HyperedgeSharedPtr>(Edges, CovWeights, 0, (int)Edges.size()-1);
+
+	// Reset bInComp and summarize weights
+	for(i=0; i < (int)Edges.size(); i++) {
+		ctx.label(Edges[i]) == 0 ? InComp[i] = false : InComp[i] = true;
+		CovWeights[i] = -CovWeights[i];
+	}
+	weight = 0;
+	for(i=(int)Edges.size()-1; i >= 0; i--) {
+		weight += CovWeights[i];
+		CovWeights[i] = weight;
+	}
+
+	// Number the nodes to be covered and store the numbers of the nodes in each hyperedge
+	i = 0;
+	for(auto v : Vertices)
+		ctx.setLabel(v, i++);
+
+	State.EdgeVertexOffsets.assign(1, 0);
+	State.EdgeVertices.clear();
+	for(auto &he : Edges) {
+		for(auto v : he->allVertices())
+			if(ctx.label(v) >= 0)
+				State.EdgeVertices.push_back(ctx.label(v));
+		State.EdgeVertexOffsets.push_back((int)State.EdgeVertices.size());
+	}
+
+	State.CovCounts.assign(Vertices.size(), 0);
+	State.Uncovered = (int)Vertices.size();
+	State.NbrSel = State.InCompSel = 0;
+
+	// Select an initial subset of at most iMyK hyperedges
+	return coverNodes(Edges, Set, InComp, CovWeights, State, false);
+}
+
+
+/*
+***Description***
+The method selects the next subset within a set of hyperedges such that a given set of 
+nodes is covered. The selection is continued from the state left by the previous call.
+
+INPUT:	Nodes: Array of nodes to be covered
+		Edges: Array of hyperedges
+		Set: Integer array of indices in Edges representing a subset selection
+		bInComp: Boolean array indicating the position of each hyperedge
+		CovWeights: Array with the number of connector nodes covered by each hyperedge
+		State: Selection state of the previous call
+OUTPUT: Set: Selection of hyperedges in Edges such that all nodes in Nodes are covered
+		return: Number of selected hyperedges; -1 if there is no alternative selection
+*/
+
+int DetKDecomp::setNextSubset(const VertexSet &Vertices, HyperedgeVector &Edges, vector<int> &Set, vector<bool> &InComp, vector<int> &CovWeights, CoverState &State) const
+{
+	// Select the next subset of at most iMyK hyperedges
+	return coverNodes(Edges, Set, InComp, CovWeights, State, true);
+}
+
+
+void DetKDecomp::selectEdge(int Pos, const vector<bool> &InComp, CoverState &State) const
+{
+	if (InComp[Pos])
+		++State.InCompSel;
+
+	for (int i = State.EdgeVertexOffsets[Pos]; i < State.EdgeVertexOffsets[Pos + 1]; i++)
+		if (State.CovCounts[State.EdgeVertices[i]]++ == 0)
+			--State.Uncovered;
+}
+
+
+void DetKDecomp::unselectEdge(int Pos, const vector<bool> &InComp, CoverState &State) const
+{
+	if (InComp[Pos])
+		--State.InCompSel;
+
+	for (int i = State.EdgeVertexOffsets[Pos]; i < State.EdgeVertexOffsets[Pos + 1]; i++)
+		if (--State.CovCounts[State.EdgeVertices[i]] == 0)
+			++State.Uncovered;
+}
+
+
+int DetKDecomp::coverNodes(HyperedgeVector &Edges, vector<int> &Set, vector<bool> &InComp, vector<int> &CovWeights, CoverState &State, bool Next) const
+{
+	int i, pos{ 0 }, weight;
+	int size{ (int)Edges.size() };
+	bool covered, back, select;
+	SearchStats::ScopedTimer timer(SearchStats::Timer::CoverNodes);
+
+	// Undo the last selection of the previous call and continue with the next hyperedge
+	if (Next) {
+		if (State.NbrSel <= 0)
+			return -1;
+
+		pos = Set[--State.NbrSel];
+		unselectEdge(pos, InComp, State);
+		++pos;
+	}
+
+	covered = (State.Uncovered == 0);
+
+	// Search for a new set of covering hyperedges
+	while(!covered) {
+		for(back=false; !covered; pos++) { 
+
+			// Check if nodes can be covered by the remaining hyperedges;
+			// prune the search tree if not
+			i = pos + (MyK-State.NbrSel);
+			if(i < size)
+				weight = CovWeights[pos] - CovWeights[i];
+			else
+				if(pos < size)
+					weight = CovWeights[pos];
+				else
+					weight = 0;
+			if((weight < State.Uncovered) || (weight == 0)) {
+				back = true;
+				break;
+			}
+
+			// Check if the actual hyperedge covers some uncovered node
+			select = false;
+			if(InComp[pos] || (State.InCompSel > 0) || (State.NbrSel < MyK-1))
+				for(i = State.EdgeVertexOffsets[pos]; i < State.EdgeVertexOffsets[pos + 1]; i++)
+					if(State.CovCounts[State.EdgeVertices[i]] == 0) {
+						select = true;
+						break;
+					}
+
+			if (select) {
+				// Select the actual hyperedge
+				Set[State.NbrSel++] = pos;
+				selectEdge(pos, InComp, State);
+
+				// Check whether all nodes are covered
+				if(State.Uncovered == 0)
+					covered = true;
+			}
+		}
+
+		if(back) {
+			if(State.NbrSel == 0) {
+				// No more possibilities to cover the nodes
+				State.NbrSel = -1;
+				break;
+			}
+			else {
+				// Undo the last selection if the nodes cannot be covered in this way
+				pos = Set[--State.NbrSel];
+				unselectEdge(pos, InComp, State);
+				++pos;
+			}
+		}
+	}
+
+	if(State.NbrSel >= 0)
+		Set[State.NbrSel] = -1;
+
+	return State.NbrSel;
+}
+
+/*
+***Description***
+The method divides a given set of hyperedges into inner hyperedges and its boundary according
+to a given set of boundary nodes. The inner hyperedges are those not containing a boundary node.
+All other hyperedges containing a boundary node (within the given set or outside) belong to
+the boundary hyperedges.
+
+INPUT:	HEdges: Hyperedges
+		Nodes: Boundary nodes
+OUTPUT: Inner: Inner hyperedges not containing a boundary node
+		Bound: Boundary hyperedges containing a boundary node
+		return: Index in Bound that separates boundary hyperedges within and outside the given 
+		set of hyperedges; all hyperedges before this index are inside the given set and all
+		hyperedges starting at this index are outside the given set.
+*/
+
+size_t DetKDecomp::divideCompEdges(const HyperedgeVector &HEdges, const VertexSet &Vertices, HyperedgeVector &Inner, HyperedgeVector &Bound) const
+{
+	SearchContext &ctx = context();
+	const Hypergraph &hg = *MyHg;
+	HyperedgeVector innerb, outerb;
+	int i, j, b, x, y, idx;
+
+	// Scratch arrays of the redundancy check, reused by all calls of the current thread
+	static thread_local struct {
+		vector<int> offsets, sets, counts, reps, bucketOffsets, buckets, marks;
+		vector<uint64_t> sigs;
+		vector<char> removed;
+	} scratch;
+
+	// Label the hyperedges in HEdges by 1 and number the boundary nodes
+	ctx.resetEdgeLabels(0);
+	for (auto &he : HEdges)
+		ctx.setLabel(he, 1);
+
+	ctx.resetVertexLabels(-1);
+	idx = 0;
+	for (auto &v : Vertices)
+		ctx.setLabel(v, idx++);
+
+	// Compute the hyperedges containing a boundary node and store them
+	// in InnerB if they are contained in the given set and in OuterB otherwise
+	for(auto &v : Vertices)
+		for(auto &he : hg.allVertexNeighbors(v)) {
+			// Only use normal edges for separators
+			if (!he->isHeavy()) {
+				switch (ctx.label(he)) {
+				case 0:	// Hyperedge is not contained in HEdges
+					ctx.setLabel(he, -1);
+					outerb.push_back(he);
+					break;
+				case 1:	// Hyperedge is contained in HEdges
+					ctx.setLabel(he, -1);
+					innerb.push_back(he);
+					break;
+				}
+			}
+		}
+
+	// Store hyperedges not containing a boundary node in the array
+	for (auto &he : HEdges)
+		if (ctx.label(he) > 0)
+			Inner.push_back(he);
+
+	// Store the boundary nodes of each hyperedge in OuterB together with a 64-bit signature
+	int nbr_outer{ (int)outerb.size() };
+	auto &offsets = scratch.offsets, &sets = scratch.sets, &counts = scratch.counts, &reps = scratch.reps;
+	auto &bucket_offsets = scratch.bucketOffsets, &buckets = scratch.buckets, &marks = scratch.marks;
+	auto &sigs = scratch.sigs;
+	auto &removed = scratch.removed;
+
+	offsets.assign(1, 0);
+	sets.clear();
+	sigs.assign(nbr_outer, 0);
+	counts.assign(idx + 1, 0);
+	for (x = 0; x < nbr_outer; x++) {
+		for (auto &v : outerb[x]->allVertices())
+			if ((b = ctx.label(v)) >= 0) {
+				sets.push_back(b);
+				sigs[x] |= (uint64_t)1 << (b & 63);
+				++counts[b];
+			}
+		offsets.push_back((int)sets.size());
+	}
+
+	// Bucket each hyperedge by its rarest boundary node; a hyperedge whose boundary nodes are
+	// covered by another hyperedge is thus found in a bucket of a boundary node of the latter
+	bucket_offsets.assign(idx + 1, 0);
+	reps.resize(nbr_outer);
+	for (x = 0; x < nbr_outer; x++) {
+		int rare = sets[offsets[x]];
+		for (i = offsets[x] + 1; i < offsets[x + 1]; i++)
+			if (counts[sets[i]] < counts[rare])
+				rare = sets[i];
+		reps[x] = rare;
+		++bucket_offsets[rare + 1];
+	}
+	for (b = 0; b < idx; b++)
+		bucket_offsets[b + 1] += bucket_offsets[b];
+	buckets.resize(nbr_outer);
+	counts.assign(bucket_offsets.begin(), bucket_offsets.end());
+	for (x = 0; x < nbr_outer; x++)
+		buckets[counts[reps[x]]++] = x;
+
+	// Remove redundant hyperedges from OuterB; such a hyperedge is redundant if the set of its
+	// boundary nodes is covered by some other remaining hyperedge in OuterB
+	removed.assign(nbr_outer, 0);
+	marks.assign(idx, -1);
+	for (x = 0; x < nbr_outer; x++) {
+		if (removed[x])
+			continue;
+
+		for (i = offsets[x]; i < offsets[x + 1]; i++)
+			marks[sets[i]] = x;
+
+		for (i = offsets[x]; i < offsets[x + 1]; i++)
+			for (j = bucket_offsets[sets[i]]; j < bucket_offsets[sets[i] + 1]; j++) {
+				y = buckets[j];
+				if (y == x || removed[y] || (sigs[y] & ~sigs[x]) != 0)
+					continue;
+
+				bool covered = true;
+				for (int k = offsets[y]; covered && k < offsets[y + 1]; k++)
+					covered = (marks[sets[k]] == x);
+				if (covered)
+					removed[y] = 1;
+			}
+	}
+
+	// Store hyperedges containing a boundary node in the array
+	for(auto &he : innerb)
+		Bound.push_back(he);
+	for (x = 0; x < nbr_outer; x++)
+		if (!removed[x])
+			Bound.push_back(outerb[x]);
+
+	return innerb.size();
+}
+
+CompCacheSharedPtr DetKDecomp::getSepParts(SeparatorSharedPtr & sep) const
+{
+	return MyTriedSeps.get(sep);
+}
+
+
+/*
+***Description***
+The method checks whether the actual separator occurs in the MySeps list of already
+used separators. If so, the method returns two lists of hyperedges identifiying the 
+decomposable and undecomposable partitions. It is assumed that separator hyperedges 
+are labeled by -1 and no other hyperedges are labeled by -1.
+
+INPUT:	iSepSize: Size of the actual separator
+OUTPUT: Separator: Stored separator
+		SuccParts: List of decomposable partitions
+		FailParts: List of undecomposable partitions
+		return: true if separator was found; otherwise false
+*/
+/*
+bool DetKDecomp::getSepParts(int SepSize, HE_VEC **Separator, list<Hyperedge *> **SuccParts, list<Hyperedge *> **FailParts)
+{
+	int i;
+	bool found = false;
+	list<list<Hyperedge *> *>::iterator SuccPartIter, FailPartIter;
+
+	// Check whether the actual separator is known to be decomposable or undecomposable
+	SuccPartIter = MySuccSepParts.begin();
+	FailPartIter = MyFailSepParts.begin();
+	for(auto sep : MySeps) {
+		found = true;
+		i = 0;
+		for (auto he : *sep) {
+			if (he->getLabel() != -1) {
+				found = false;
+				break;
+			}
+			i++;
+		}
+
+		if(found && (i == SepSize)) {
+			*Separator = sep;
+			*SuccParts = *SuccPartIter;
+			*FailParts = *FailPartIter;
+			return true;
+		}
+
+		++SuccPartIter;
+		++FailPartIter;
+	}
+
+	return false;
+}
+*/
+
+/*
+***Description***
+The method decomposes the hyperedges in a subhypergraph as described in Gottlob and 
+Samer: A Backtracking-Based Algorithm for Computing Hypertree-Decompositions.
+
+INPUT:	HEdges: Hyperedges in the subgraph
+		Connector: Connector nodes that must be covered
+		iRecLevel: Recursion level
+OUTPUT: return: Hypertree decomposition of HEdges
+*/
+bool DetKDecomp::covers(const HyperedgeVector &Edges, const VertexSet &Vertices) const
+{
+	bool found;
+
+	for (auto v : Vertices) {
+		found = false;
+		for (auto e : Edges) {
+			if (e->find(v) != nullptr) {
+				found = true;
+				break;
+			}
+		}
+
+		if (!found)
+			return false;
+	}
+		
+	return true;
+}
+
+/*
+***Description***
+The method decomposes a component of a separator recursively and stores the outcome in the
+cache of the separator and in the component table. Undecomposable components are also learned
+as nogoods, which prune the components containing them under any separator. Components whose search was cancelled are not
+stored as undecomposable.
+
+INPUT:	comp: Component that has to be decomposed
+		fingerprint: Fingerprint of the component
+		reused: Cache of the separator
+		RecLevel: Recursion level of the component
+OUTPUT: return: Hypertree decomposition of comp (nullptr if none was found)
+*/
+
+HypertreeSharedPtr DetKDecomp::decompPartition(const DecompComponent &comp, const CompFingerprint &fingerprint, CompCache &reused, int RecLevel) const
+{
+	HypertreeSharedPtr htree = decomp(comp, RecLevel);
+
+	// A cancelled search does not prove that the component is undecomposable
+	if (htree == nullptr && interrupted())
+		return nullptr;
+	SearchStats::countComponent(RecLevel, htree != nullptr);
+	if (MyMemo != nullptr)
+		MyMemo->record(memoKey(comp), htree != nullptr);
+	MyComponents.record(fingerprint, htree != nullptr, htree);
+	if (htree == nullptr && !MyBIP)
+		MyNogoods.insert(fingerprint);
+
+	lock_guard<mutex> guard(reused.lock);
+	if (htree == nullptr)
+		reused.insertFailed(fingerprint);
+	else
+		reused.insertSucc(fingerprint);
+
+	return htree;
+}
+
+HypertreeSharedPtr DetKDecomp::decompSeparator(SeparatorSharedPtr separator, const HyperedgeVector &HEdges, const VertexSet &Connector, int RecLevel) const
+{
+	size_t cnt_edges{ HEdges.size() };
+	size_t nbr_of_parts;
+	vector<DecompComponent> partitions;
+	vector<CompFingerprint> fingerprints;
+	vector<bool> cut_parts;
+	list<HypertreeSharedPtr> Subtrees;
+	HypertreeSharedPtr htree{ nullptr };
+
+	if (!trySeparator())
+		return nullptr;
+	SearchTrace::Scope trace(RecLevel, separator->signature());
+
+	// Check if selected hyperedges were already used before as separator; the entry is kept
+	// alive while the separator is tried, even if the cache evicts it meanwhile
+	CompCacheSharedPtr cache = getSepParts(separator);
+	CompCache &reused = *cache;
+
+	//Debugging output
+	/*
+	cout << "+++ Separator: ";
+	for (int i = 0; i < separator->size(); i++) {
+		cout << (*separator)[i]->getName();
+		if (i < separator->size()-1)
+			cout << ",";
+	}
+	cout << endl;
+	*/
+
+	// Separate hyperedges into partitions with corresponding connector nodes
+	nbr_of_parts = separate(separator, HEdges, partitions);
+	SearchTrace::event(SearchTrace::Kind::Split, RecLevel, (uint32_t)nbr_of_parts);
+
+	// Create auxiliary arrays
+	cut_parts.resize(nbr_of_parts);
+	fingerprints.resize(nbr_of_parts);
+
+	// Check partitions for decomposibility and undecomposibility
+	{
+		lock_guard<mutex> guard(reused.lock);
+		bool decomposable;
+
+		for (size_t i = 0; i < partitions.size(); i++) {
+			fingerprints[i] = partitions[i].fingerprint();
+
+			if (partitions[i].size() >= cnt_edges) {
+				//writeErrorMsg("Monotonicity violated.", "DetKDecomp::decomp");
+				SearchStats::count(SearchStats::Counter::SepsPruned);
+				reused.insertFailed(fingerprints[i]);
+				return nullptr;
+			}
+
+			// Check for undecomposability
+			if (reused.failed.find(fingerprints[i]) != reused.failed.end()) {
+				SearchStats::count(SearchStats::Counter::CacheHits);
+				SearchTrace::event(SearchTrace::Kind::Cache, RecLevel + 1, SearchTrace::HitFailed);
+				SearchStats::count(SearchStats::Counter::SepsPruned);
+				return nullptr;
+			}
+
+			// Check for decomposibility
+			if (reused.succ.find(fingerprints[i]) != reused.succ.end()) {
+				SearchStats::count(SearchStats::Counter::CacheHits);
+				SearchTrace::event(SearchTrace::Kind::Cache, RecLevel + 1, SearchTrace::HitDecomposed);
+				cut_parts[i] = true;
+			}
+			else if (MyComponents.lookup(fingerprints[i], decomposable)) {
+				// Components produced by other separators are added to the cache of the separator
+				SearchStats::count(SearchStats::Counter::CacheHits);
+				SearchTrace::event(SearchTrace::Kind::Cache, RecLevel + 1, decomposable ? SearchTrace::HitDecomposed : SearchTrace::HitFailed);
+				if (!decomposable) {
+					SearchStats::count(SearchStats::Counter::SepsPruned);
+					reused.insertFailed(fingerprints[i]);
+					return nullptr;
+				}
+				reused.insertSucc(fingerprints[i]);
+				cut_parts[i] = true;
+			}
+			else if (MyMemo != nullptr && MyMemo->lookup(memoKey(partitions[i]), decomposable)) {
+				// Components known from earlier runs are added to the cache of the separator
+				SearchStats::count(SearchStats::Counter::CacheHits);
+				SearchTrace::event(SearchTrace::Kind::Cache, RecLevel + 1, decomposable ? SearchTrace::HitDecomposed : SearchTrace::HitFailed);
+				MyComponents.record(fingerprints[i], decomposable);
+				if (!decomposable) {
+					SearchStats::count(SearchStats::Counter::SepsPruned);
+					reused.insertFailed(fingerprints[i]);
+					return nullptr;
+				}
+				reused.insertSucc(fingerprints[i]);
+				cut_parts[i] = true;
+			}
+			else if (!MyBIP && MyNogoods.contains(fingerprints[i])) {
+				// The component contains a component that failed under another separator
+				SearchStats::count(SearchStats::Counter::NogoodHits);
+				SearchTrace::event(SearchTrace::Kind::Cache, RecLevel + 1, SearchTrace::HitFailed);
+				SearchStats::count(SearchStats::Counter::SepsPruned);
+				MyComponents.record(fingerprints[i], false);
+				reused.insertFailed(fingerprints[i]);
+				return nullptr;
+			}
+			else {
+				SearchStats::count(SearchStats::Counter::CacheMisses);
+				SearchTrace::event(SearchTrace::Kind::Cache, RecLevel + 1, SearchTrace::Miss);
+				cut_parts[i] = false;
+			}
+		}
+	}
+
+	// Decompose the components concurrently if more than one has to be decomposed
+	bool concurrent{ MyPool != nullptr && RecLevel < MyCompDepth && count(cut_parts.begin(), cut_parts.end(), false) > 1 };
+	vector<HypertreeSharedPtr> comp_trees;
+
+	if (concurrent) {
+		TaskGroup comps(*MyPool);
+
+		// The first component that fails cancels its siblings
+		comp_trees.resize(nbr_of_parts);
+		for (size_t i = 0; i < partitions.size(); i++)
+			if (!cut_parts[i])
+				comps.run([this, &partitions, &fingerprints, &reused, &comp_trees, &comps, i, RecLevel]() {
+					if ((comp_trees[i] = decompPartition(partitions[i], fingerprints[i], reused, RecLevel + 1)) == nullptr)
+						comps.cancel();
+				});
+
+		comps.wait();
+	}
+
+	// Decompose partitions into hypertrees
+	for (size_t i = 0; i < partitions.size(); i++) {
+		if (cut_parts[i]) {
+			// Prune subtree
+			htree = getCutNode(RecLevel + 1, partitions[i]);
+		}
+		else if (concurrent)
+			htree = comp_trees[i];
+		else
+			htree = decompPartition(partitions[i], fingerprints[i], reused, RecLevel + 1);
+
+		if (htree != nullptr)
+			Subtrees.push_back(htree);
+		else {
+			trace.setResult(false, interrupted());
+			return nullptr;
+		}
+	}
+
+	// All components decomposed; create a new hypertree node
+	trace.setResult(true);
+	return getHTNode(HEdges, separator, Connector, Subtrees);
+}
+
+HypertreeSharedPtr DetKDecomp::decompCandidate(const SeparatorSharedPtr &separator, const HyperedgeVector &HEdges, const VertexSet &Connector, int RecLevel) const
+{
+	HypertreeSharedPtr htree = decompSeparator(separator, HEdges, Connector, RecLevel);
+
+	if (MyBIP && htree == nullptr && !interrupted()) {
+		SubedgeSeparatorFactory sub_sep_fac;
+		SeparatorSharedPtr sub_separator;
+
+		//Start sub_edge procedure
+		{
+			lock_guard<mutex> guard(MySubedgeLock);
+			sub_sep_fac.init(context(), HEdges, separator, MySubedges);
+		}
+
+		// Try all subedge separators that still cover all connector nodes
+		while (htree == nullptr && !interrupted() && (sub_separator = sub_sep_fac.next())->size() != 0)
+			if (covers(sub_separator, Connector))
+				htree = decompSeparator(sub_separator, HEdges, Connector, RecLevel);
+	}
+
+	return htree;
+}
+
+HypertreeSharedPtr DetKDecomp::decomp(const HyperedgeVector &HEdges, const VertexSet &Connector, int RecLevel) const
+{
+	int i;
+	
+	SeparatorSharedPtr separator{ nullptr };
+	vector<int> cov_sep_set, cov_weights;
+	CoverState cover;
+	vector<bool> in_comp;
+	int comp_end, nbr_sel_cov, i_add;
+	bool add_edge;
+    HypertreeSharedPtr htree{ nullptr };
+	HyperedgeVector inner_edges, bound_edges, add_edges;
+
+	// Separator candidates are tried concurrently at the top recursion levels
+	bool parallel{ MyPool != nullptr && RecLevel < MyParallelDepth };
+	unique_ptr<TaskGroup> candidates;
+	mutex htree_lock;
+
+	/*
+	for (int k = 0; k <= RecLevel; k++)
+		cout << "+";
+	cout << " " << *HEdges << endl;
+	*/
+
+	if (interrupted())
+		return nullptr;
+
+	SearchTrace::Scope trace(RecLevel, HEdges.size());
+	if ((htree = decompTrivial(HEdges, Connector)) != nullptr) {
+		trace.setResult(true);
+		return htree;
+	}
+
+	// Divide hyperedges into inner hyperedges and hyperedges containing some connecting nodes
+	comp_end = (int)divideCompEdges(HEdges, Connector, inner_edges, bound_edges);
+
+	in_comp.resize(bound_edges.size());
+	cov_weights.resize(bound_edges.size(),0);
+	cov_sep_set.resize(MyK+1);
+	for(i=0; i < bound_edges.size(); i++)
+		i < comp_end ? in_comp[i] = true : in_comp[i] = false;
+
+	// Select initial hyperedges to cover the connecting nodes
+	nbr_sel_cov = setInitSubset(Connector, bound_edges, cov_sep_set, in_comp, cov_weights, cover);
+
+	// Initialize AddEdges array
+	for (i = 0; i < bound_edges.size(); i++)
+		if (in_comp[i])
+			if (!bound_edges[i]->isHeavy())
+				add_edges.push_back(bound_edges[i]);
+	for (i = 0; i < inner_edges.size(); i++)
+		if (!inner_edges[i]->isHeavy())
+			add_edges.push_back(inner_edges[i]);
+	if(add_edges.size() <= 0)
+		writeErrorMsg("Illegal number of hyperedges.", "DetKDecomp::decomp");
+
+	if (parallel)
+		candidates = make_unique<TaskGroup>(*MyPool);
+
+	// Stops the enumeration of separators if a decomposition was found or the search was cancelled
+	auto done = [&]() {
+		return parallel ? candidates->isCancelled() || interrupted() : (htree != nullptr || interrupted());
+	};
+
+	if(nbr_sel_cov >= 0)
+		do {
+			// Check whether a covering hyperedge within the component was selected
+			add_edge = true;
+			for(i=0; i < nbr_sel_cov; i++)
+				if(in_comp[cov_sep_set[i]]) {
+					add_edge = false;
+					break;
+				}
+
+			// Stop if no inner hyperedge can be in the separator
+			if(!add_edge || (MyK-nbr_sel_cov > 0)) {
+
+				i_add = 0;
+
+				do {
+					// Output the search progress
+					// cout << "(" << RecLevel << ")" << endl;
+
+					// Create a separator 
+					separator = make_shared<Separator>(MyHg->core());
+
+					for(i=0; i < nbr_sel_cov; i++) 
+						separator->insert(bound_edges[cov_sep_set[i]]);
+					
+					if (add_edge)
+						separator->insert(add_edges[i_add]);
+
+					if (parallel) {
+						// Try the separator as a task; the first successful task cancels the others
+						candidates->run([this, separator, &HEdges, &Connector, RecLevel, &htree, &htree_lock, &candidates]() {
+							HypertreeSharedPtr subtree = decompCandidate(separator, HEdges, Connector, RecLevel);
+							if (subtree != nullptr) {
+								lock_guard<mutex> guard(htree_lock);
+								if (htree == nullptr)
+									htree = subtree;
+								candidates->cancel();
+							}
+						});
+
+						// Limit the number of queued candidates by working on them
+						while (candidates->pending() > 4 * MyPool->nbrOfThreads() && MyPool->runPendingTask());
+					}
+					else
+						htree = decompCandidate(separator, HEdges, Connector, RecLevel);
+					
+				} while(add_edge && !done() && (++i_add < add_edges.size()));
+			}
+
+		} while(!done() && ((nbr_sel_cov = setNextSubset(Connector, bound_edges, cov_sep_set, in_comp, cov_weights, cover)) > 0));
+
+	if (parallel)
+		candidates->wait();
+
+	trace.setResult(htree != nullptr, interrupted());
+	return htree;
+}
+
+
+/*
+***Description***
+The method changes the maximum width of the decomposition and keeps the cached components
+that are still valid: a component decomposable with width k is decomposable with any larger
+width, and a component undecomposable with width k is undecomposable with any smaller width.
+
+INPUT:	k: New maximum width
+*/
+
+void DetKDecomp::setWidth(int k)
+{
+	MyTriedSeps.forEach([this, k](CompCache &cache) {
+		if (k > MyK)
+			cache.clearFailed();
+		else if (k < MyK)
+			cache.clearSucc();
+	});
+	if (k > MyK) {
+		MyComponents.clearUndecomposable();
+		MyNogoods.clear();
+	}
+	else if (k < MyK)
+		MyComponents.clearDecomposable();
+
+	// Subedges depend on the width
+	if (MyBIP && k != MyK)
+		MySubedges = make_unique<Subedges>(MyHg, k);
+
+	Decomp::setWidth(k);
+	updateMemoContext();
+}
+
+
+/*
+***Description***
+The method sets a persistent store of components. The keys of the components contain the
+hypergraph, the width, and the algorithm, so a single store may be shared by runs on several
+hypergraphs (e.g., the blocks of a hypergraph) and with several widths.
+
+INPUT:	Store: Persistent store (nullptr if none is used)
+*/
+
+void DetKDecomp::setMemoStore(const MemoStoreSharedPtr &Store)
+{
+	MyMemo = Store;
+	if (MyMemo != nullptr)
+		MyMemoHg = MemoStore::hashHypergraph(*MyHg);
+	updateMemoContext();
+}
+
+void DetKDecomp::updateMemoContext()
+{
+	MyMemoContext = MemoStore::Key();
+	if (MyMemo == nullptr)
+		return;
+
+	MyMemoContext.add(MyMemoHg);
+	MyMemoContext.add(MemoStore::hashName("k=" + to_string(MyK)));
+	MyMemoContext.add(MemoStore::hashName(MyBIP ? "localbip" : "det"));
+}
+
+MemoStore::Key DetKDecomp::memoKey(const DecompComponent &comp) const
+{
+	MemoStore::Key key{ MyMemoContext };
+
+	for (auto &he : comp.component())
+		key.add(MemoStore::hashEdge(he));
+
+	// Connector vertices are told apart from hyperedges by complementing their hash values
+	for (auto &v : comp.connector())
+		key.add(~MemoStore::hashVertex(v));
+
+	return key;
+}
+
+void DetKDecomp::setRestarts(RestartPolicy Policy, size_t Base)
+{
+	if (Base == 0)
+		writeErrorMsg("Illegal number of separators.", "DetKDecomp::setRestarts");
+
+	MyRestarts = Policy;
+	MyRestartBase = Base;
+}
+
+/*
+***Description***
+The method returns the separator budget of a run. The Luby sequence (1, 1, 2, 1, 1, 2, 4, ...)
+mixes short runs with rare long ones; the geometric sequence doubles the budget in each run.
+
+INPUT:	Run: Number of the run (starting with 1)
+OUTPUT: return: Number of separators the run may try
+*/
+
+size_t DetKDecomp::getRestartLimit(size_t Run) const
+{
+	size_t factor{ 1 };
+
+	if (MyRestarts == RestartPolicy::Luby) {
+		// Find the smallest k with Run <= 2^k - 1; the sequence repeats itself below 2^(k-1)
+		for (;;) {
+			size_t k{ 1 };
+			while (((size_t)1 << k) - 1 < Run)
+				k++;
+			if (Run == ((size_t)1 << k) - 1) {
+				factor = (size_t)1 << (k - 1);
+				break;
+			}
+			Run -= ((size_t)1 << (k - 1)) - 1;
+		}
+	}
+	else if (MyRestarts == RestartPolicy::Geometric)
+		factor = Run < 8 * sizeof(size_t) / 2 ? (size_t)1 << (Run - 1) : (size_t)1 << (8 * sizeof(size_t) / 2);
+
+	return MyRestartBase * factor;
+}
+
+bool parseRestartPolicy(const string &Spec, RestartPolicy &Policy, size_t &Base)
+{
+	size_t sep = Spec.find(':');
+	string name = Spec.substr(0, sep);
+
+	if (name == "luby")
+		Policy = RestartPolicy::Luby;
+	else if (name == "geometric")
+		Policy = RestartPolicy::Geometric;
+	else if (name == "none")
+		Policy = RestartPolicy::None;
+	else
+		return false;
+
+	if (sep != string::npos) {
+		string base = Spec.substr(sep + 1);
+		char *end;
+		Base = (size_t)strtoul(base.c_str(), &end, 10);
+		if (base.empty() || *end != '\0' || Base == 0)
+			return false;
+	}
+
+	return true;
+}
+
+/*
+***Description***
+The method configures the parallel search: separator candidates at the recursion levels
+below Depth and sibling components of separators at the recursion levels below CompDepth
+are distributed as tasks over a pool of NbrOfThreads threads.
+
+INPUT:	NbrOfThreads: Number of threads (1 disables the parallel search)
+		Depth: Number of recursion levels at which candidates are tried in parallel
+		CompDepth: Number of recursion levels at which components are decomposed concurrently
+*/
+
+void DetKDecomp::setParallel(size_t NbrOfThreads, int Depth, int CompDepth)
+{
+	if (NbrOfThreads <= 1) {
+		MyPool = nullptr;
+		MyContexts.clear();
+		MyParallelDepth = 0;
+		MyCompDepth = 0;
+		return;
+	}
+
+	MyPool = make_unique<WorkStealingPool>(NbrOfThreads);
+	MyContexts.assign(NbrOfThreads, SearchContext(MyHg->core()));
+	MyParallelDepth = Depth;
+	MyCompDepth = CompDepth;
+}
+
+
+/*
+***Description***
+The method expands pruned hypertree nodes, i.e., subgraphs which were not decomposed but are
+known to be decomposable. A pruned node is replaced by a copy of the decomposition stored in
+the component table; only components without a stored decomposition (e.g., since they were
+evicted or taken from a persistent store) are decomposed once more. Copied decompositions may
+contain pruned nodes themselves, which are expanded in the same way.
+
+INPUT:	HTree: Hypertree that has to be expanded
+OUTPUT: HTree: Expanded hypertree
+*/
+
+void DetKDecomp::expandHTree(HypertreeSharedPtr &HTree)
+{
+	HypertreeSharedPtr cut_node, subtree;
+	
+	while((cut_node = HTree->getCutNode()) != nullptr) {
+
+		// Store subgraph in an array
+		auto &lambda = cut_node->getLambda();
+		HyperedgeVector edges(lambda.begin(), lambda.end());
+
+		// Store connector nodes in an array
+		auto &chi = cut_node->getChi();
+		VertexSet connector(chi);
+
+		// Reconstruct parent separator
+		auto parent = cut_node->getParent().lock();
+		auto &parent_lambda = parent->getLambda();
+		Separator parent_sep(MyHg->core(), HyperedgeVector(parent_lambda.begin(),parent_lambda.end()));
+
+		// Look up the decomposition of the subgraph
+		bool decomposable{ false };
+		if (MyComponents.lookup(DecompComponent::fingerprint(lambda, chi), decomposable, &subtree) && subtree != nullptr)
+			subtree = subtree->clone();
+		else {
+			// Decompose subgraph
+			subtree = decomp(edges, connector, cut_node->getLabel());
+			if (subtree == nullptr && interrupted())
+				return;
+		}
+		if(subtree == nullptr)
+			writeErrorMsg("Illegal decomposition pruning.", "H_DetKDecomp::expandHTree");
+
+		// Replace the pruned node by the corresponding subtree
+		parent->insChild(subtree);
+		parent->remChild(cut_node);
+
+	}
+}
+
+
+/*
+***Description***
+The method builds a hypertree decomposition of a given hypergraph as described in Gottlob 
+and Samer: A Backtracking-Based Algorithm for Computing Hypertree-Decompositions.
+
+INPUT:	iK: Maximum separator size
+OUTPUT: return: Hypertree decomposition of HGraph
+*/
+
+HypertreeSharedPtr DetKDecomp::buildHypertree()
+{
+	return buildRootedHypertree(VertexSet());
+}
+
+
+/*
+***Description***
+The method builds a hypertree decomposition whose root covers the given vertices. With a
+restart policy, each run gets a budget of separators (charged to the budget of the whole
+search as well). A run exhausting its budget is abandoned and the search restarts with a new
+randomized MCS ordering of the hyperedges (the first run uses the chosen heuristic). The
+separator cache is kept across the runs: the decomposability of a component does not depend
+on the ordering, and components of an abandoned run are not stored as undecomposable.
+
+INPUT:	Root: Vertices to be covered by the root
+OUTPUT: return: Hypertree decomposition (nullptr if none exists or the budget is exhausted)
+*/
+
+HypertreeSharedPtr DetKDecomp::buildRootedHypertree(const VertexSet &Root)
+{
+	HypertreeSharedPtr HTree;
+	HyperedgeVector HEdges;
+	SearchBudgetSharedPtr budget = MyBudget;
+
+	MyNbrOfRestarts = 0;
+	for (size_t run = 1; ; run++) {
+		if (MyRestarts != RestartPolicy::None)
+			MyBudget = make_shared<SearchBudget>(0, getRestartLimit(run), 0, budget);
+
+		// Order hyperedges heuristically; since only the MCS ordering is randomized, later runs use
+		// a new MCS ordering whichever heuristic was chosen for the first one
+		HEdges = run == 1 ? MyHg->getEdgeOrder(MyOrder) : MyHg->getMCSOrder();
+
+		//cout << HEdges << endl;
+
+		// Store initial heuristic order as weight
+		//for(int i=0; i < HEdges.size(); i++)
+		//	HEdges[i]->setWeight(i);
+
+		// Build hypertree decomposition; the vertices of the root are treated like a connector
+		HTree = decomp(HEdges, Root);
+
+		// Stop unless the run exhausted its own budget
+		if (MyRestarts == RestartPolicy::None || HTree != nullptr || !MyBudget->exhausted() || TaskGroup::cancelled() || (budget != nullptr && budget->exhausted()))
+			break;
+		MyNbrOfRestarts++;
+	}
+	MyBudget = budget;
+
+	if (MyNbrOfRestarts > 0)
+		*MyLog << "Search restarted " << MyNbrOfRestarts << " times." << endl;
+
+	// Expand pruned hypertree nodes
+	if((HTree != nullptr) && (HTree->getCutNode() != nullptr)) {
+		*MyLog << "Expanding hypertree ..." << endl;
+
+		// Pruned components are known to be decomposable, so the budget does not apply
+		SearchBudgetSharedPtr budget = move(MyBudget);
+		expandHTree(HTree);
+		MyBudget = budget;
+
+		// A cancelled expansion leaves pruned nodes behind
+		if (HTree->getCutNode() != nullptr)
+			HTree = nullptr;
+	}
+
+	// The stored decompositions are part of the hypertree, which the caller may change
+	if (HTree != nullptr)
+		MyComponents.clearSubtrees();
+
+	return HTree;
+}
+
+
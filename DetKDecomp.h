@@ -5,9 +5,18 @@
 #if !defined(CLS_DetKDecomp)
 #define CLS_DetKDecomp
 
+#include <mutex>
+
 #include "Globals.h"
 #include "Decomp.h"
 #include "Separator.h"
+#include "ComponentTable.h"
+#include "DecompComponent.h"
+#include "MemoStore.h"
+#include "NogoodStore.h"
+#include "SeparatorCache.h"
+#include "SearchContext.h"
+#include "WorkStealingPool.h"
 
 class Hypergraph;
 class Hyperedge;
@@ -15,32 +24,102 @@ class Hypertree;
 class Vertex;
 class Subedges;
 
-struct CompCache {
-	// Separator component already successfully decomposed
-	list<HyperedgeSharedPtr> succ;
-	// fractional width for succ components
-	unordered_map<HyperedgeSharedPtr,double> succFW;
-	// Separator component not decomposable
-	list<HyperedgeSharedPtr> failed;
+// Selection state of the enumeration of hyperedge subsets covering a set of vertices; it is
+// kept between the calls of setInitSubset and setNextSubset, so that the next subset is found
+// by undoing the last selection instead of replaying the whole selection
+struct CoverState {
+	// Indices of the vertices to be covered that occur in each hyperedge (CSR over the hyperedges)
+	vector<int> EdgeVertexOffsets;
+	vector<int> EdgeVertices;
+	// Number of selected hyperedges covering each vertex
+	vector<int> CovCounts;
+	// Number of uncovered vertices, of selected hyperedges, and of selected hyperedges within the component
+	int Uncovered{ 0 };
+	int NbrSel{ 0 };
+	int InCompSel{ 0 };
 };
 
+// Policies for restarting the search with a new ordering of the hyperedges
+enum class RestartPolicy { None, Luby, Geometric };
+
+// Converts a restart policy of the form <luby|geometric>[:<base>]; returns false if it is illegal
+bool parseRestartPolicy(const string &Spec, RestartPolicy &Policy, size_t &Base);
+
 class DetKDecomp : public Decomp
 {
 protected:
-	mutable unordered_map<SeparatorSharedPtr,CompCache> MyTriedSeps;
+	// Components of the tried separators known to be decomposable or undecomposable
+	mutable SeparatorCache<SeparatorSharedPtr> MyTriedSeps;
+
+	// Outcomes and decompositions of the components of all separators, which are reused by every
+	// separator producing the same component and by the expansion of pruned nodes
+	mutable ComponentTable MyComponents;
+
+	// Undecomposable components of all separators; a component containing one of them is
+	// undecomposable, too (not used with subedges, since they depend on the component)
+	mutable NogoodStore MyNogoods;
+
+	// Labels of vertices and edges used during the search
+	mutable SearchContext MyContext;
+
+	// Thread pool of the parallel search (nullptr if the search is sequential)
+	unique_ptr<WorkStealingPool> MyPool;
+
+	// Separator candidates up to this recursion level are tried in parallel
+	int MyParallelDepth{ 0 };
+
+	// Sibling components of separators up to this recursion level are decomposed concurrently
+	int MyCompDepth{ 0 };
+
+	// Restart policy and number of separators of the first run (later runs get multiples of it)
+	RestartPolicy MyRestarts{ RestartPolicy::None };
+	size_t MyRestartBase{ 1000 };
+
+	// Number of restarts of the last search
+	size_t MyNbrOfRestarts{ 0 };
+
+	// Returns the separator budget of a run (Run >= 1) according to the restart policy
+	size_t getRestartLimit(size_t Run) const;
+
+	// Labels used by the threads of the pool (one context per thread)
+	mutable vector<SearchContext> MyContexts;
+
+	// Protects the subedges in the parallel search
+	mutable mutex MySubedgeLock;
+
+	// Persistent store of decomposable and undecomposable components (nullptr if there is none)
+	MemoStoreSharedPtr MyMemo;
+
+	// Canonical hash of the hypergraph and part of the keys of all components in MyMemo, which
+	// also contain the width and the algorithm
+	uint64_t MyMemoHg{ 0 };
+	MemoStore::Key MyMemoContext;
+
+	// Computes MyMemoContext for the current width
+	void updateMemoContext();
+
+	// Returns the key of a component in MyMemo
+	MemoStore::Key memoKey(const DecompComponent &comp) const;
+
+	// Returns the labels of the current thread
+	SearchContext &context() const { return MyPool == nullptr ? MyContext : MyContexts[MyPool->currentThread()]; }
 
 	// Run BIP algorithm
 	bool MyBIP;
 	std::unique_ptr<Subedges> MySubedges;
 
 	// Initializes a Boolean array representing a subset selection
-	virtual int setInitSubset(const VertexSet &Vertices, HyperedgeVector &Edges,  vector<int> &Set, vector<bool> &InComp, vector<int> &CovWeights) const;
+	virtual int setInitSubset(const VertexSet &Vertices, HyperedgeVector &Edges,  vector<int> &Set, vector<bool> &InComp, vector<int> &CovWeights, CoverState &State) const;
 
 	// Selects the next subset in a Boolean array representing a subset selection
-	virtual int setNextSubset(const VertexSet &Vertices, HyperedgeVector &Edges, vector<int> &Set, vector<bool> &InComp, vector<int> &CovWeights) const;
+	virtual int setNextSubset(const VertexSet &Vertices, HyperedgeVector &Edges, vector<int> &Set, vector<bool> &InComp, vector<int> &CovWeights, CoverState &State) const;
 
 	// Covers a set of nodes by a set of edges
-	int coverNodes(HyperedgeVector &Edges, vector<int> &Set, vector<bool> &InComp, vector<int> &CovWeights, size_t Uncovered, bool Reconstr) const;
+	int coverNodes(HyperedgeVector &Edges, vector<int> &Set, vector<bool> &InComp, vector<int> &CovWeights, CoverState &State, bool Next) const;
+
+	// Adds resp. removes a hyperedge to resp. from the selection in State
+	void selectEdge(int Pos, const vector<bool> &InComp, CoverState &State) const;
+	void unselectEdge(int Pos, const vector<bool> &InComp, CoverState &State) const;
 
 	// Orders hyperedges according to maximum cardinality search
 	//void orderMCS(Hyperedge **HEdges, int iNbrOfEdges);
@@ -49,10 +128,7 @@ protected:
 	size_t divideCompEdges(const HyperedgeVector &HEdges, const VertexSet &Vertices, HyperedgeVector &Inner, HyperedgeVector &Bound) const;
 
 	// Returns the partitions to a given separator that are known to be decomposable or undecomposable
-	CompCache &getSepParts(SeparatorSharedPtr &sep) const;
-
-	// Checks whether HEdges contains an edge labeled with iLabel
-	bool containsLabel(list<Hyperedge *> *HEdges, int iLabel);
+	CompCacheSharedPtr getSepParts(SeparatorSharedPtr &sep) const;
 
 	// Checks whether the parent connector nodes are distributed to different components
 	//bool isSplitSep(Node **Connector, Node ***ChildConnectors);
@@ -60,17 +136,26 @@ protected:
 	// Checks whether a set of edges or a separator covers a set of vertices
 	bool covers(const HyperedgeVector &Edges, const VertexSet &Vertices) const;
 	bool covers(const SeparatorSharedPtr &Edges, const VertexSet &Vertices) const {
-		return covers(Edges->edges(),Vertices);
+		return Edges->coversAll(Vertices);
 	}
 	
 
+	// Decomposes a component and records the result in the cache of its separator
+	HypertreeSharedPtr decompPartition(const DecompComponent &comp, const CompFingerprint &fingerprint, CompCache &reused, int RecLevel) const;
+
+	// Decomposes a set of hyperedges using a given separator
+	HypertreeSharedPtr decompSeparator(SeparatorSharedPtr separator, const HyperedgeVector &HEdges, const VertexSet &Connector, int RecLevel) const;
+
+	// Decomposes a set of hyperedges using a given separator or (if MyBIP) subedge separators derived from it
+	HypertreeSharedPtr decompCandidate(const SeparatorSharedPtr &separator, const HyperedgeVector &HEdges, const VertexSet &Connector, int RecLevel) const;
+
 	// Builds a hypertree decomposition according to k-decomp by covering connector nodes
 	virtual HypertreeSharedPtr decomp(const HyperedgeVector &HEdges, const VertexSet &Connector=VertexSet(), int RecLevel = 0) const;
 	virtual HypertreeSharedPtr decomp(const DecompComponent &comp, int recLevel) const {
 		return decomp(comp.component(), comp.connector(), recLevel);
 	}
 
-	// Expands cut hypertree nodes
+	// Expands cut hypertree nodes by the decompositions in the component table or by decomposing them
 	void expandHTree(HypertreeSharedPtr &HTree);
 
 public:
@@ -82,6 +167,42 @@ public:
 
 	// Constructs a hypertree decomposition of width at most MyK (if it exists)
 	virtual HypertreeSharedPtr buildHypertree();
+
+	// Constructs a hypertree decomposition of width at most MyK whose root covers the given vertices
+	virtual HypertreeSharedPtr buildRootedHypertree(const VertexSet &Root);
+
+	// Changes the maximum width; decomposable components are kept in the cache if k grows,
+	// undecomposable ones if k shrinks
+	virtual void setWidth(int k);
+
+	// Tries separator candidates of the top Depth recursion levels in parallel and decomposes sibling
+	// components of the top CompDepth recursion levels concurrently using the given number of threads
+	void setParallel(size_t NbrOfThreads, int Depth = 2, int CompDepth = 0);
+
+	// Restarts the search with a new ordering whenever a run exhausts its separator budget; the
+	// budget of the first run is Base and later runs get budgets according to the policy
+	void setRestarts(RestartPolicy Policy, size_t Base = 1000);
+
+	// Looks up components in the given persistent store before decomposing them and records
+	// the decomposable and undecomposable ones in it
+	void setMemoStore(const MemoStoreSharedPtr &Store);
+
+	// Returns the number of restarts of the last search
+	size_t getNbrOfRestarts() const { return MyNbrOfRestarts; }
+
+	// Returns the number of separators found resp. not found in the separator cache
+	size_t getSepCacheHits() const { return MyTriedSeps.hits(); }
+	size_t getSepCacheMisses() const { return MyTriedSeps.misses(); }
+
+	// Limits the estimated memory of the caches (0 if unlimited); the separator cache gets half of
+	// the limit, the component table and the nogoods a quarter each. The separators and components
+	// used least recently are evicted if they exceed their share, and no more nogoods are learned
+	// once they reach theirs
+	void setCacheLimit(size_t Bytes) {
+		MyTriedSeps.setLimit(Bytes - Bytes / 2);
+		MyComponents.setLimit(Bytes / 4);
+		MyNogoods.setLimit(Bytes / 4);
+	}
 };
 
 
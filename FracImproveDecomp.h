@@ -31,6 +31,9 @@ private:
 
 	VertexSet computeChi(const HyperedgeVector &comp, const shared_ptr<Separator> &Sep, const VertexSet &Connector) const;
 
+	// Decomposes a component and records the result in the cache of its separator
+	HypertreeSharedPtr decompPartition(const DecompComponent &comp, const CompFingerprint &fingerprint, CompCache &reused, double &outFW, int RecLevel) const;
+
 	// Builds a hypertree decomposition according to k-decomp by covering connector nodes
 	virtual HypertreeSharedPtr decomp(const HyperedgeVector &HEdges, double &outFW, const VertexSet &Connector = VertexSet(), int RecLevel = 0) const;
 
@@ -47,6 +50,11 @@ public:
 
 	// Constructs a hypertree decomposition of width at most iK (if it exists)
 	HypertreeSharedPtr buildHypertree(double minImprovement, double &fw);
+
+	using DetKDecomp::setParallel;
+	using DetKDecomp::setBudget;
+	using DetKDecomp::setEdgeOrder;
+	using DetKDecomp::setCacheLimit;
 };
 
 
@@ -1,4 +1,6 @@
 #include <iostream>
+#include <memory>
+#include <random>
 #include <vector>
 
 #include "Globals.h"
@@ -90,6 +92,24 @@ char *uitoa(unsigned int iNumber, char *cString)
 
 
 
+// Random numbers of the current thread (nullptr if rand() is used) and the ones used before
+static thread_local unique_ptr<mt19937> tRandom;
+static thread_local vector<unique_ptr<mt19937>> tPrevRandom;
+
+void seed_random_thread(unsigned int iSeed)
+{
+	tPrevRandom.push_back(move(tRandom));
+	tRandom = make_unique<mt19937>(iSeed);
+}
+
+void restore_random_thread()
+{
+	if (tPrevRandom.empty())
+		return;
+	tRandom = move(tPrevRandom.back());
+	tPrevRandom.pop_back();
+}
+
 int random_range(int iLB, int iUB)
 {
 	int iRange;
@@ -97,6 +117,9 @@ int random_range(int iLB, int iUB)
 	if (iLB > iUB)
 		writeErrorMsg("Lower bound larger than upper bound.", "random_range");
 
+	if (tRandom != nullptr)
+		return uniform_int_distribution<int>(iLB, iUB)(*tRandom);
+
 	iRange = (iUB - iLB) + 1;
 	return iLB + (int)(iRange * (rand() / (RAND_MAX + 1.0)));
 }
@@ -1,356 +1,570 @@
-
-#include <algorithm>
-#include <cmath>
-#include <memory>
-
-#include "Globals.h"
-#include "Hypergraph.h"
-#include "CombinationIterator.h"
-#include "Parser.h"
-
-void Hypergraph::labelReachEdges(const HyperedgeSharedPtr &edge, int label) const
-{
-	edge->setLabel(label);
-
-	for (auto e : EdgeNeighbors.at(edge))
-		if (e->getLabel() == 0)
-			labelReachEdges(e, label);
-}
-
-
-void Hypergraph::buildHypergraph(Parser &P)
-{
-	VertexVector vertices;
-	HyperedgeSharedPtr edge;
-
-	for (int i = 0; i < P.getNbrOfVars(); i++)
-		vertices.push_back(std::make_shared<Vertex>(P.getVariable(i)));
-
-	for (int i = 0; i < P.getNbrOfAtoms(); i++) {
-		edge = std::make_shared<Hyperedge>(P.getAtom(i));
-		for (int j = 0; j < P.getNbrOfVars(i); j++) 
-			edge->add(vertices[P.getNextAtomVar()]);
-		this->insertEdge(edge);
-	}
-}
-
-bool Hypergraph::hasAllEdges(const HyperedgeVector &edges) const
-{
-	for (auto he : edges)
-		if (!hasEdge(he))
-			return false;
-
-	return true;
-}
-
-bool Hypergraph::hasAllEdges(const HyperedgeSet &edges) const
-{
-	for (auto he : edges)
-		if (!hasEdge(he))
-			return false;
-
-	return true;
-}
-
-HyperedgeSharedPtr Hypergraph::getEdgeByID(int id) const
-{
-	for (auto he : Edges)
-		if (he->getId() == id)
-			return he;
-
-	return nullptr;
-}
-
-VertexSharedPtr Hypergraph::getVertexByID(int id) const
-{
-	for (auto v : Vertices)
-		if (v->getId() == id)
-			return v;
-	return nullptr;
-}
-
-void Hypergraph::setVertexLabels(int value) const
-{
-	for (auto v : Vertices)
-		v->setLabel(value);
-}
-
-void Hypergraph::setEdgeLabels(int value) const
-{
-	for (auto he : Edges)
-		he->setLabel(value);
-}
-
-void Hypergraph::setAllLabels(int value) const
-{
-	setVertexLabels(value);
-	setEdgeLabels(value);
-}
-
-/*
-void Hypergraph::resetEdgeLabels(int val)
-{
-	for (auto he : Edges)
-		he->setLabel(val);
-}
-
-void Hypergraph::resetVertexLabels(int val)
-{
-	for (auto v : Vertices)
-		v->setLabel(val);
-}
-*/
-
-void Hypergraph::insertEdge(const HyperedgeSharedPtr &edge)
-{
-	if (getEdgeByID(edge->getId()) != nullptr )
-		writeErrorMsg("This hypergraph already contains a Hyperedge with id " + to_string(edge->getId()), "Hypergraph::insertEdge");
-
-	if (dynamic_pointer_cast<Superedge>(edge) != nullptr)
-		CntSuperedges++;
-
-	Edges.insert(edge);
-
-	for (auto v : edge->allVertices()) {
-		if (find(Vertices.begin(), Vertices.end(), v) == Vertices.end())
-			Vertices.insert(v);
-		EdgeNeighbors[edge].insert(VertexNeighbors[v].cbegin(), VertexNeighbors[v].cend());
-		for (auto e : VertexNeighbors[v])
-			EdgeNeighbors[e].insert(edge);
-	    VertexNeighbors[v].insert(edge);
-	}
-}
-
-
-bool Hypergraph::isConnected() const
-{
-	setAllLabels();
-
-	if (getNbrOfEdges() > 0)
-		labelReachEdges(*Edges.begin());
-	
-	for (auto e : Edges)
-		if (e->getLabel() == 0)
-			return false;
-
-	return true;
-}
-
-void Hypergraph::makeDual(Hypergraph & hg) const
-{
-	unordered_map<uint, VertexSharedPtr> newVertices;
-
-	//Every edge becomes a vertex
-	for (auto e : Edges)
-		newVertices[e->getId()] = make_shared<Vertex>(e->getId(), e->getName());
-
-	//Every vertex becomes an edge
-	for (auto v : Vertices) {
-		HyperedgeSharedPtr e = make_shared<Hyperedge>(v->getId(), v->getName());
-		for (auto n : allVertexNeighbors(v))
-			e->add(newVertices[n->getId()]);
-		hg.insertEdge(e);
-	}
-	
-}
-
-HyperedgeVector Hypergraph::getMCSOrder()
-{
-	HyperedgeVector order;
-	HyperedgeVector candidates;
-	HyperedgeSet::iterator he_iter;
-	uint max_card{ 0 };
-	uint tmp_card{ 0 };
-	
-	HyperedgeSharedPtr he;
-
-	//Reset edge labels (used to determine which hyperedges have been removed)
-	setEdgeLabels();
-
-	//Select randomly an initial hyperedge
-	auto it = Edges.begin();
-	for (int i = 0; i < random_range(0, Edges.size() - 1); i++, it++);
-	he = *it;
-	he->setLabel(1);
-	order.push_back(he);
-	
-	//Remove nodes with highest connectivity iteratively
-	do {
-		he = nullptr;
-		he_iter = Edges.begin();
-		max_card = 0 ;
-		//find first vertex that has not been removed yet
-		for (; he_iter != Edges.end() && (*he_iter)->getLabel() != 0; he_iter++);
-		if (he_iter != Edges.end()) {
-			//count its connectivity
-			he = *he_iter;
-			for (auto n : allEdgeNeighbors(he))
-				max_card += n->getLabel();
-			candidates.push_back(he);
-
-			// Search for the node with highest connectivity, 
-			// i.e., with highest number of neighbours in the set of nodes already removed
-			for (; he_iter != Edges.end(); he_iter++) {
-				he = *he_iter;
-				if (he->getLabel() == 0) {
-					tmp_card = 0;
-					for (auto n : allEdgeNeighbors(he))
-						tmp_card += n->getLabel();
-					if (tmp_card >= max_card) {
-						if (tmp_card > max_card) {
-							candidates.clear();
-							max_card = tmp_card;
-						}
-						candidates.push_back(he);
-					}
-				}
-			}
-
-			//randomly select the next node with highest connectivity
-			he = candidates[random_range(0, candidates.size() - 1)];
-			candidates.clear();
-			he->setLabel(1);
-			order.push_back(he);
-		}
-	} while (he != nullptr);
-
-	return order;
-}
-
-int Hypergraph::degree() const
-{
-	int maxDegree = 0;
-
-	for (const VertexSharedPtr v : Vertices) {
-		int degree;
-		try {
-			degree = VertexNeighbors.at(v).size();
-		}
-		catch (const std::out_of_range& oor) {
-			degree = 0;
-		}
-		if (degree > maxDegree) maxDegree = degree;
-	}
-
-	return maxDegree;
-}
-
-int Hypergraph::bip(int k) const
-{
-	int maxBip = 0;
-	HyperedgeVector edges(Edges.begin(), Edges.end());
-
-	if (k <= Edges.size()) {
-		CombinationIterator comb(Edges.size(), k);
-		comb.setStage(k);
-		int *indices;
-		while ((indices = comb.next()) != nullptr) {
-			VertexVector vertices;
-
-			for (auto v : edges[indices[0]]->allVertices()) {
-				bool found = true;
-				for (int i = 1; indices[i] != -1 && found; i++)
-					if (find(edges[indices[i]]->allVertices().begin(), edges[indices[i]]->allVertices().end(), v) == edges[indices[i]]->allVertices().end())
-						found = false;
-
-				if (found)
-					vertices.push_back(v);
-			}
-
-			if (vertices.size() > maxBip)
-				maxBip = vertices.size();
-		}
-	}
-	else {
-		VertexVector vertices;
-
-		for (auto v : edges[0]->allVertices()) {
-			bool found = true;
-			for (int i = 1; i < edges.size() && found; i++)
-				if (find(edges[i]->allVertices().begin(), edges[i]->allVertices().end(), v) == edges[i]->allVertices().end())
-					found = false;
-
-			if (found)
-				vertices.push_back(v);
-		}
-
-		return vertices.size();
-	}
-
-	return maxBip;
-}
-
-int Hypergraph::vcDimension() const
-{
-	int maxVC = (int)floor(log(Edges.size()) / log(2));
-	int i;
-	VertexVector vertices(Vertices.begin(), Vertices.end());
-
-	//Find the maximum cardinality of a shattered subset of V
-	for (i = 1; i <= maxVC; i++) {
-		bool shattered = false;
-
-		//For each subset X of size vc check if it is shattered, if X is shattered then vc is at least i
-		int *indices;
-		CombinationIterator cit(vertices.size(), i);
-		cit.setStage(i);
-		while ((indices = cit.next()) != nullptr && !shattered) {
-			bool check_x = true;
-			set_type set_x;
-			for (int j = 0; indices[j] != -1; j++)
-				set_x.insert(vertices[indices[j]]);
-			//Collection<String> setX = cit.next();
-			//PowerSetIterator<String> itPSetX = new PowerSetIterator<String>(setX);
-			powerset_type pow_set_x = powerset(set_x);
-
-			//For each A \subseteq X check if there is an edge s.t. A = X \cap e
-			//if there is a subset such that this check fails (checkX = false), then X is not shattered.
-			for (powerset_type::iterator iter = pow_set_x.begin();
-				iter != pow_set_x.end() && check_x;
-				++iter) {
-
-				bool edge_found = false;
-				for (auto e_it = Edges.begin(); e_it != Edges.end() && !edge_found; e_it++) {
-					set_type help_x;
-
-					for (auto v : set_x) {
-						if (find((*e_it)->allVertices().begin(), (*e_it)->allVertices().end(), v) != (*e_it)->allVertices().end())
-							help_x.insert(v);
-					}
-
-					if (help_x == *iter)
-						edge_found = true;
-				}
-
-				if (!edge_found)
-					check_x = false;
-
-			}
-
-			if (check_x)
-				shattered = true;
-
-		}
-
-		if (!shattered)
-			return i - 1;
-
-	}
-			
-
-	return i - 1;
-}
-
-int Hypergraph::arity() const
-{
-	int ari = 0;
-	int help = 0;
-	for (auto e : Edges)
-		if ((help = e->getNbrOfVertices()) > ari)
-			ari = help;
-
-	return ari;
-}
-
-
-
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+
+#include "Globals.h"
+#include "Hypergraph.h"
+#include "CombinationIterator.h"
+#include "Parser.h"
+
+void Hypergraph::buildHypergraph(Parser &P)
+{
+	VertexVector vertices;
+	HyperedgeVector edges;
+	HyperedgeSharedPtr edge;
+
+	vertices.reserve(P.getNbrOfVars());
+	for (int i = 0; i < P.getNbrOfVars(); i++)
+		vertices.push_back(std::make_shared<Vertex>(P.getVariable(i)));
+
+	edges.reserve(P.getNbrOfAtoms());
+	for (int i = 0; i < P.getNbrOfAtoms(); i++) {
+		edge = std::make_shared<Hyperedge>(P.getAtom(i));
+		for (int j = 0; j < P.getNbrOfVars(i); j++) 
+			edge->add(vertices[P.getNextAtomVar()]);
+		edges.push_back(edge);
+	}
+
+	build(edges);
+}
+
+bool Hypergraph::hasAllEdges(const HyperedgeVector &edges) const
+{
+	for (auto he : edges)
+		if (!hasEdge(he))
+			return false;
+
+	return true;
+}
+
+bool Hypergraph::hasAllEdges(const HyperedgeSet &edges) const
+{
+	for (auto he : edges)
+		if (!hasEdge(he))
+			return false;
+
+	return true;
+}
+
+HyperedgeSharedPtr Hypergraph::getEdgeByID(int id) const
+{
+	auto it = EdgesByID.find(id);
+	return it != EdgesByID.end() ? it->second : nullptr;
+}
+
+VertexSharedPtr Hypergraph::getVertexByID(int id) const
+{
+	auto it = VerticesByID.find(id);
+	return it != VerticesByID.end() ? it->second : nullptr;
+}
+
+/*
+void Hypergraph::resetEdgeLabels(int val)
+{
+	for (auto he : Edges)
+		he->setLabel(val);
+}
+
+void Hypergraph::resetVertexLabels(int val)
+{
+	for (auto v : Vertices)
+		v->setLabel(val);
+}
+*/
+
+void Hypergraph::registerEdge(const HyperedgeSharedPtr &edge)
+{
+	if (!EdgesByID.emplace(edge->getId(), edge).second)
+		writeErrorMsg("This hypergraph already contains a Hyperedge with id " + to_string(edge->getId()), "Hypergraph::insertEdge");
+
+	if (dynamic_pointer_cast<Superedge>(edge) != nullptr)
+		CntSuperedges++;
+
+	Edges.insert(edge);
+	Core = nullptr;
+	CoreBuilt = make_unique<once_flag>();
+
+	for (auto &v : edge->allVertices()) {
+		if (VerticesByID.emplace(v->getId(), v).second)
+			Vertices.insert(v);
+		VertexNeighbors[v].insert(edge);
+	}
+}
+
+void Hypergraph::linkEdge(const HyperedgeSharedPtr &edge)
+{
+	// Create the entry even if the edge has no neighbours
+	HyperedgeSet &neighbors = EdgeNeighbors[edge];
+
+	for (auto &v : edge->allVertices())
+		for (auto &e : VertexNeighbors[v])
+			if (e != edge && neighbors.insert(e).second)
+				EdgeNeighbors[e].insert(edge);
+}
+
+void Hypergraph::insertEdge(const HyperedgeSharedPtr &edge)
+{
+	registerEdge(edge);
+	linkEdge(edge);
+}
+
+void Hypergraph::build(const HyperedgeVector &edges)
+{
+	// Register all edges first such that the neighbourhoods are computed in a single pass
+	for (auto &he : edges)
+		registerEdge(he);
+	for (auto &he : edges)
+		linkEdge(he);
+
+	core();
+}
+
+const HypergraphCoreSharedPtr &Hypergraph::core() const
+{
+	call_once(*CoreBuilt, [this]() {
+		HyperedgeVector edges(Edges.begin(), Edges.end());
+		VertexVector vertices(Vertices.begin(), Vertices.end());
+		vector<HyperedgeVector> vertexNeighbors, edgeNeighbors;
+
+		vertexNeighbors.reserve(vertices.size());
+		for (auto &v : vertices) {
+			auto it = VertexNeighbors.find(v);
+			if (it != VertexNeighbors.end())
+				vertexNeighbors.emplace_back(it->second.begin(), it->second.end());
+			else
+				vertexNeighbors.emplace_back();
+		}
+
+		edgeNeighbors.reserve(edges.size());
+		for (auto &e : edges) {
+			auto it = EdgeNeighbors.find(e);
+			if (it != EdgeNeighbors.end())
+				edgeNeighbors.emplace_back(it->second.begin(), it->second.end());
+			else
+				edgeNeighbors.emplace_back();
+		}
+
+		Core = make_shared<const HypergraphCore>(edges, vertices, vertexNeighbors, edgeNeighbors);
+	});
+
+	return Core;
+}
+
+bool Hypergraph::isConnected() const
+{
+	const HypergraphCore &hg = *core();
+	vector<bool> reached(hg.nbrOfEdges(), false);
+	vector<uint> stack;
+	size_t cnt_reached{ 0 };
+
+	if (hg.nbrOfEdges() == 0)
+		return true;
+
+	// Label all edges reachable from the first edge
+	stack.push_back(0);
+	reached[0] = true;
+	while (!stack.empty()) {
+		uint e = stack.back();
+		stack.pop_back();
+		++cnt_reached;
+		for (auto n : hg.edgeNeighbors(e))
+			if (!reached[n]) {
+				reached[n] = true;
+				stack.push_back(n);
+			}
+	}
+
+	return cnt_reached == hg.nbrOfEdges();
+}
+
+void Hypergraph::makeDual(Hypergraph & hg) const
+{
+	unordered_map<uint, VertexSharedPtr> newVertices;
+
+	//Every edge becomes a vertex
+	for (auto e : Edges)
+		newVertices[e->getId()] = make_shared<Vertex>(e->getId(), e->getName());
+
+	//Every vertex becomes an edge
+	for (auto v : Vertices) {
+		HyperedgeSharedPtr e = make_shared<Hyperedge>(v->getId(), v->getName());
+		for (auto n : allVertexNeighbors(v))
+			e->add(newVertices[n->getId()]);
+		hg.insertEdge(e);
+	}
+	
+}
+
+HyperedgeVector Hypergraph::getMCSOrder()
+{
+	const HypergraphCore &hg = *core();
+	size_t cnt_edges{ hg.nbrOfEdges() };
+	HyperedgeVector order;
+	vector<uint> candidates;
+	// Edge labels (1 if the hyperedge has been removed, 0 otherwise)
+	vector<uint> removed(cnt_edges, 0);
+	uint he_iter;
+	uint max_card{ 0 };
+	uint tmp_card{ 0 };
+	int he;
+
+	//Select randomly an initial hyperedge
+	for (he = 0; he < random_range(0, cnt_edges - 1); he++);
+	removed[he] = 1;
+	order.push_back(hg.edge(he));
+	
+	//Remove nodes with highest connectivity iteratively
+	do {
+		he = -1;
+		he_iter = 0;
+		max_card = 0 ;
+		//find first vertex that has not been removed yet
+		for (; he_iter < cnt_edges && removed[he_iter] != 0; he_iter++);
+		if (he_iter < cnt_edges) {
+			//count its connectivity
+			for (auto n : hg.edgeNeighbors(he_iter))
+				max_card += removed[n];
+			candidates.push_back(he_iter);
+
+			// Search for the node with highest connectivity, 
+			// i.e., with highest number of neighbours in the set of nodes already removed
+			for (; he_iter < cnt_edges; he_iter++) {
+				if (removed[he_iter] == 0) {
+					tmp_card = 0;
+					for (auto n : hg.edgeNeighbors(he_iter))
+						tmp_card += removed[n];
+					if (tmp_card >= max_card) {
+						if (tmp_card > max_card) {
+							candidates.clear();
+							max_card = tmp_card;
+						}
+						candidates.push_back(he_iter);
+					}
+				}
+			}
+
+			//randomly select the next node with highest connectivity
+			he = candidates[random_range(0, candidates.size() - 1)];
+			candidates.clear();
+			removed[he] = 1;
+			order.push_back(hg.edge(he));
+		}
+	} while (he >= 0);
+
+	return order;
+}
+
+bool parseEdgeOrder(const string &Name, EdgeOrder &Order)
+{
+	if (Name == "mcs")
+		Order = EdgeOrder::MCS;
+	else if (Name == "mindeg")
+		Order = EdgeOrder::MinDegree;
+	else if (Name == "minfill")
+		Order = EdgeOrder::MinFill;
+	else if (Name == "maxsize")
+		Order = EdgeOrder::MaxSize;
+	else
+		return false;
+
+	return true;
+}
+
+string getEdgeOrderName(EdgeOrder Order)
+{
+	switch (Order) {
+	case EdgeOrder::MinDegree:
+		return "mindeg";
+	case EdgeOrder::MinFill:
+		return "minfill";
+	case EdgeOrder::MaxSize:
+		return "maxsize";
+	default:
+		return "mcs";
+	}
+}
+
+HyperedgeVector Hypergraph::getEdgeOrder(EdgeOrder Order)
+{
+	switch (Order) {
+	case EdgeOrder::MinDegree:
+		return getMinDegreeOrder();
+	case EdgeOrder::MinFill:
+		return getMinFillOrder();
+	case EdgeOrder::MaxSize:
+		return getMaxSizeOrder();
+	default:
+		return getMCSOrder();
+	}
+}
+
+/*
+***Description***
+The method eliminates the vertices of the primal graph one by one. In each step it selects
+the vertex with the fewest remaining neighbours (resp. the vertex whose neighbours miss the
+fewest edges among each other), connects all its neighbours and removes it. Ties are broken
+by the degree and then by the index of the vertex. For min-fill, the fill values are only
+recomputed for vertices within distance two of the eliminated vertex.
+
+INPUT:	MinFill: Select vertices by the number of fill edges instead of their degree
+OUTPUT: return: Indices of the vertices (in the hypergraph core) in the order of elimination
+*/
+
+vector<uint> Hypergraph::getEliminationOrder(bool MinFill) const
+{
+	const HypergraphCore &hg = *core();
+	size_t cnt_vertices{ hg.nbrOfVertices() };
+	vector<unordered_set<uint>> adj(cnt_vertices);
+	vector<size_t> fill(cnt_vertices, 0);
+	vector<char> eliminated(cnt_vertices, 0), dirty(cnt_vertices, 1);
+	vector<uint> order;
+
+	// Build the primal graph
+	for (uint e = 0; e < hg.nbrOfEdges(); e++)
+		for (auto v : hg.edgeVertices(e))
+			for (auto w : hg.edgeVertices(e))
+				if (v != w)
+					adj[v].insert(w);
+
+	// Number of missing edges between the neighbours of a vertex
+	auto countFill = [&adj](uint v) {
+		size_t cnt{ 0 };
+		for (auto a : adj[v])
+			for (auto b : adj[v])
+				if (a < b && adj[a].find(b) == adj[a].end())
+					cnt++;
+		return cnt;
+	};
+
+	order.reserve(cnt_vertices);
+	while (order.size() < cnt_vertices) {
+		uint best{ 0 };
+		size_t best_score{ 0 };
+		bool found{ false };
+
+		for (uint v = 0; v < cnt_vertices; v++) {
+			if (eliminated[v])
+				continue;
+			if (MinFill && dirty[v]) {
+				fill[v] = countFill(v);
+				dirty[v] = 0;
+			}
+			size_t score = MinFill ? fill[v] : adj[v].size();
+			if (!found || score < best_score || (score == best_score && adj[v].size() < adj[best].size())) {
+				best = v;
+				best_score = score;
+				found = true;
+			}
+		}
+
+		// Turn the neighbourhood into a clique and remove the vertex
+		eliminated[best] = 1;
+		order.push_back(best);
+		for (auto a : adj[best]) {
+			adj[a].erase(best);
+			for (auto b : adj[best])
+				if (a != b)
+					adj[a].insert(b);
+		}
+		if (MinFill)
+			for (auto a : adj[best]) {
+				dirty[a] = 1;
+				for (auto b : adj[a])
+					dirty[b] = 1;
+			}
+		adj[best].clear();
+	}
+
+	return order;
+}
+
+HyperedgeVector Hypergraph::getEliminationEdgeOrder(bool MinFill) const
+{
+	const HypergraphCore &hg = *core();
+	vector<uint> order = getEliminationOrder(MinFill);
+	vector<size_t> position(hg.nbrOfVertices()), last(hg.nbrOfEdges(), 0);
+	vector<uint> edges(hg.nbrOfEdges());
+	HyperedgeVector result;
+
+	for (size_t i = 0; i < order.size(); i++)
+		position[order[i]] = i;
+
+	// Position of the last eliminated vertex of each edge (+1 to distinguish empty edges)
+	for (uint e = 0; e < hg.nbrOfEdges(); e++) {
+		edges[e] = e;
+		for (auto v : hg.edgeVertices(e))
+			last[e] = max(last[e], position[v] + 1);
+	}
+
+	// The vertices eliminated last form the root of the decomposition, so their edges come first
+	stable_sort(edges.begin(), edges.end(), [&](uint a, uint b) {
+		return last[a] != last[b] ? last[a] > last[b] : hg.edgeSize(a) > hg.edgeSize(b);
+	});
+
+	result.reserve(edges.size());
+	for (auto e : edges)
+		result.push_back(hg.edge(e));
+
+	return result;
+}
+
+HyperedgeVector Hypergraph::getMaxSizeOrder() const
+{
+	const HypergraphCore &hg = *core();
+	vector<uint> edges(hg.nbrOfEdges());
+	HyperedgeVector result;
+
+	for (uint e = 0; e < hg.nbrOfEdges(); e++)
+		edges[e] = e;
+
+	stable_sort(edges.begin(), edges.end(), [&hg](uint a, uint b) {
+		if (hg.edgeSize(a) != hg.edgeSize(b))
+			return hg.edgeSize(a) > hg.edgeSize(b);
+		return hg.nbrOfEdgeNeighbors(a) > hg.nbrOfEdgeNeighbors(b);
+	});
+
+	result.reserve(edges.size());
+	for (auto e : edges)
+		result.push_back(hg.edge(e));
+
+	return result;
+}
+
+int Hypergraph::degree() const
+{
+	int maxDegree = 0;
+
+	for (const VertexSharedPtr v : Vertices) {
+		int degree;
+		try {
+			degree = VertexNeighbors.at(v).size();
+		}
+		catch (const std::out_of_range& oor) {
+			degree = 0;
+		}
+		if (degree > maxDegree) maxDegree = degree;
+	}
+
+	return maxDegree;
+}
+
+int Hypergraph::bip(int k) const
+{
+	int maxBip = 0;
+	HyperedgeVector edges(Edges.begin(), Edges.end());
+
+	if (k <= Edges.size()) {
+		CombinationIterator comb(Edges.size(), k);
+		comb.setStage(k);
+		int *indices;
+		while ((indices = comb.next()) != nullptr) {
+			VertexVector vertices;
+
+			for (auto v : edges[indices[0]]->allVertices()) {
+				bool found = true;
+				for (int i = 1; indices[i] != -1 && found; i++)
+					if (find(edges[indices[i]]->allVertices().begin(), edges[indices[i]]->allVertices().end(), v) == edges[indices[i]]->allVertices().end())
+						found = false;
+
+				if (found)
+					vertices.push_back(v);
+			}
+
+			if (vertices.size() > maxBip)
+				maxBip = vertices.size();
+		}
+	}
+	else {
+		VertexVector vertices;
+
+		for (auto v : edges[0]->allVertices()) {
+			bool found = true;
+			for (int i = 1; i < edges.size() && found; i++)
+				if (find(edges[i]->allVertices().begin(), edges[i]->allVertices().end(), v) == edges[i]->allVertices().end())
+					found = false;
+
+			if (found)
+				vertices.push_back(v);
+		}
+
+		return vertices.size();
+	}
+
+	return maxBip;
+}
+
+int Hypergraph::vcDimension() const
+{
+	int maxVC = (int)floor(log(Edges.size()) / log(2));
+	int i;
+	VertexVector vertices(Vertices.begin(), Vertices.end());
+
+	//Find the maximum cardinality of a shattered subset of V
+	for (i = 1; i <= maxVC; i++) {
+		bool shattered = false;
+
+		//For each subset X of size vc check if it is shattered, if X is shattered then vc is at least i
+		int *indices;
+		CombinationIterator cit(vertices.size(), i);
+		cit.setStage(i);
+		while ((indices = cit.next()) != nullptr && !shattered) {
+			bool check_x = true;
+			set_type set_x;
+			for (int j = 0; indices[j] != -1; j++)
+				set_x.insert(vertices[indices[j]]);
+			//Collection<String> setX = cit.next();
+			//PowerSetIterator<String> itPSetX = new PowerSetIterator<String>(setX);
+			powerset_type pow_set_x = powerset(set_x);
+
+			//For each A \subseteq X check if there is an edge s.t. A = X \cap e
+			//if there is a subset such that this check fails (checkX = false), then X is not shattered.
+			for (powerset_type::iterator iter = pow_set_x.begin();
+				iter != pow_set_x.end() && check_x;
+				++iter) {
+
+				bool edge_found = false;
+				for (auto e_it = Edges.begin(); e_it != Edges.end() && !edge_found; e_it++) {
+					set_type help_x;
+
+					for (auto v : set_x) {
+						if (find((*e_it)->allVertices().begin(), (*e_it)->allVertices().end(), v) != (*e_it)->allVertices().end())
+							help_x.insert(v);
+					}
+
+					if (help_x == *iter)
+						edge_found = true;
+				}
+
+				if (!edge_found)
+					check_x = false;
+
+			}
+
+			if (check_x)
+				shattered = true;
+
+		}
+
+		if (!shattered)
+			return i - 1;
+
+	}
+			
+
+	return i - 1;
+}
+
+int Hypergraph::arity() const
+{
+	int ari = 0;
+	int help = 0;
+	for (auto e : Edges)
+		if ((help = e->getNbrOfVertices()) > ari)
+			ari = help;
+
+	return ari;
+}
+
+
+
@@ -4,16 +4,27 @@
 #define CLS_HYPERGRAPH
 
 #include<memory>
+#include<mutex>
 #include<vector>
 #include<unordered_map>
 #include<unordered_set>
 
 #include "Globals.h"
+#include "HypergraphCore.h"
 #include "Superedge.h"
 #include "Hyperedge.h"
 #include "Parser.h"
 #include "NamedEntity.h"
 
+// Heuristics for ordering the hyperedges before the search
+enum class EdgeOrder { MCS, MinDegree, MinFill, MaxSize };
+
+// Converts the name of an ordering (mcs, mindeg, minfill, maxsize); returns false if the name is unknown
+bool parseEdgeOrder(const string &Name, EdgeOrder &Order);
+
+// Returns the name of an ordering heuristic accepted by parseEdgeOrder
+string getEdgeOrderName(EdgeOrder Order);
+
 class Hypergraph : NamedEntity
 { 
 private:
@@ -26,11 +37,31 @@ private:
 	unordered_map<VertexSharedPtr, HyperedgeSet> VertexNeighbors;
 	unordered_map<HyperedgeSharedPtr, HyperedgeSet> EdgeNeighbors;
 
+	// Hashed ID indices of the edges and vertices
+	unordered_map<uint, HyperedgeSharedPtr> EdgesByID;
+	unordered_map<uint, VertexSharedPtr> VerticesByID;
+
 	//Nbr of heavy edges (weight > 1)
 	int CntSuperedges{ 0 };
 
-	// Labels all edges reachable from Edge
-	void labelReachEdges(const HyperedgeSharedPtr &edge, int label = 1) const;
+	// Dense representation of the hypergraph (built on demand, invalidated by insertEdge)
+	mutable HypergraphCoreSharedPtr Core;
+
+	// Ensures that Core is built once even if several threads request it (renewed by insertEdge)
+	mutable unique_ptr<once_flag> CoreBuilt{ make_unique<once_flag>() };
+
+	// Calculates an elimination ordering of the vertices in the primal graph that eliminates
+	// a vertex of minimum degree (resp. with a minimum number of fill edges) in each step
+	vector<uint> getEliminationOrder(bool MinFill) const;
+
+	// Orders the hyperedges such that edges containing vertices eliminated late come first
+	HyperedgeVector getEliminationEdgeOrder(bool MinFill) const;
+
+	// Adds an edge and its vertices to the edge/vertex sets and to the vertex neighbourhoods
+	void registerEdge(const HyperedgeSharedPtr &edge);
+
+	// Connects an already registered edge with all edges sharing a vertex with it
+	void linkEdge(const HyperedgeSharedPtr &edge);
 
 public:
 	Hypergraph() : NamedEntity() {}
@@ -68,10 +99,6 @@ public:
 	// Returns the node with ID iID
 	VertexSharedPtr getVertexByID(int id) const;
 
-	void setVertexLabels(int value = 0) const;
-	void setEdgeLabels(int value = 0) const;
-	void setAllLabels(int value = 0) const;
-
 	// Sets labels of all edges to zero
 	//void resetEdgeLabels(int val = 0);
 
@@ -81,6 +108,12 @@ public:
 	// Inserts an hyperedge into the hypergraph
 	void insertEdge(const HyperedgeSharedPtr &edge);
 
+	// Inserts a set of hyperedges at once and builds the dense representation
+	void build(const HyperedgeVector &edges);
+
+	// Returns the dense CSR representation of the hypergraph (built on first use)
+	const HypergraphCoreSharedPtr &core() const;
+
 	// Checks whether the hypergraph is connected
 	bool isConnected() const;
 
@@ -174,6 +207,21 @@ public:
 	 */
 	HyperedgeVector getMCSOrder();
 
+	/* Calculates an ordering of the hyperedges from a min-degree resp. 
+	 * min-fill elimination ordering of the primal graph. Ties are 
+	 * broken deterministically.
+	 */
+	HyperedgeVector getMinDegreeOrder() const { return getEliminationEdgeOrder(false); }
+	HyperedgeVector getMinFillOrder() const { return getEliminationEdgeOrder(true); }
+
+	/* Orders the hyperedges by decreasing size (ties are broken by 
+	 * decreasing number of neighbouring edges).
+	 */
+	HyperedgeVector getMaxSizeOrder() const;
+
+	// Calculates an ordering of the hyperedges using the given heuristic
+	HyperedgeVector getEdgeOrder(EdgeOrder Order);
+
 	/*
 	 * Hypergraph Properties
 	 */
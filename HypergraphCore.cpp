@@ -0,0 +1,85 @@
+#include <algorithm>
+
+#include "HypergraphCore.h"
+
+void HypergraphCore::IndexMap::init(const vector<uint> &ids)
+{
+	MyTable.clear();
+	MyHashTable.clear();
+
+	if (ids.empty())
+		return;
+
+	auto range = minmax_element(ids.begin(), ids.end());
+	size_t span = (size_t)*range.second - *range.first + 1;
+
+	// Use a direct lookup table unless the IDs are very sparse
+	if (span <= 4 * ids.size() + 64) {
+		MyOffset = *range.first;
+		MyTable.assign(span, -1);
+		for (uint i = 0; i < ids.size(); i++)
+			MyTable[ids[i] - MyOffset] = i;
+	}
+	else {
+		MyHashTable.reserve(ids.size());
+		for (uint i = 0; i < ids.size(); i++)
+			MyHashTable[ids[i]] = i;
+	}
+}
+
+/*
+***Description***
+Builds the dense representation of a hypergraph. The edges and vertices receive the
+indices of their positions in the given vectors, the neighbour lists are parallel to these
+vectors. The order of all adjacency lists is kept, hence algorithms iterating over the core
+visit the entities in the same order as when iterating over the hypergraph.
+
+INPUT:	edges: Hyperedges of the hypergraph
+		vertices: Vertices of the hypergraph
+		vertexNeighbors: Edges containing vertices[i]
+		edgeNeighbors: Edges sharing a vertex with edges[i]
+*/
+
+HypergraphCore::HypergraphCore(const HyperedgeVector &edges, const VertexVector &vertices,
+	const vector<HyperedgeVector> &vertexNeighbors, const vector<HyperedgeVector> &edgeNeighbors)
+	: MyEdges{ edges }, MyVertices{ vertices }
+{
+	vector<uint> ids;
+
+	ids.reserve(max(edges.size(), vertices.size()));
+	for (auto &e : edges)
+		ids.push_back(e->getId());
+	MyEdgeIndex.init(ids);
+
+	ids.clear();
+	for (auto &v : vertices)
+		ids.push_back(v->getId());
+	MyVertexIndex.init(ids);
+
+	// Edge -> vertex incidence
+	MyEdgeOffsets.reserve(edges.size() + 1);
+	MyEdgeOffsets.push_back(0);
+	for (auto &e : edges) {
+		for (auto &v : e->allVertices())
+			MyEdgeVertices.push_back(MyVertexIndex[v->getId()]);
+		MyEdgeOffsets.push_back((uint)MyEdgeVertices.size());
+	}
+
+	// Vertex -> edge incidence
+	MyVertexOffsets.reserve(vertices.size() + 1);
+	MyVertexOffsets.push_back(0);
+	for (auto &neighbors : vertexNeighbors) {
+		for (auto &e : neighbors)
+			MyVertexEdges.push_back(MyEdgeIndex[e->getId()]);
+		MyVertexOffsets.push_back((uint)MyVertexEdges.size());
+	}
+
+	// Edge -> edge adjacency
+	MyNeighborOffsets.reserve(edges.size() + 1);
+	MyNeighborOffsets.push_back(0);
+	for (auto &neighbors : edgeNeighbors) {
+		for (auto &e : neighbors)
+			MyEdgeNeighbors.push_back(MyEdgeIndex[e->getId()]);
+		MyNeighborOffsets.push_back((uint)MyEdgeNeighbors.size());
+	}
+}
@@ -0,0 +1,102 @@
+#pragma once
+// Immutable compressed-sparse-row representation of a hypergraph.
+//
+//////////////////////////////////////////////////////////////////////
+
+#if !defined(CLS_HYPERGRAPHCORE)
+#define CLS_HYPERGRAPHCORE
+
+#include <memory>
+#include <vector>
+#include <unordered_map>
+
+#include "Globals.h"
+#include "Hyperedge.h"
+#include "Vertex.h"
+
+class HypergraphCore
+{
+private:
+	// Maps global entity IDs onto dense indices 0..n-1
+	class IndexMap
+	{
+	private:
+		// Smallest ID stored in the direct lookup table
+		uint MyOffset{ 0 };
+
+		// Direct lookup table (used if the IDs are not too sparse)
+		vector<int> MyTable;
+
+		// Fallback for sparse ID ranges
+		unordered_map<uint, int> MyHashTable;
+
+	public:
+		void init(const vector<uint> &ids);
+
+		int operator[](uint id) const {
+			if (!MyTable.empty())
+				return (id >= MyOffset && id - MyOffset < MyTable.size()) ? MyTable[id - MyOffset] : -1;
+			auto it = MyHashTable.find(id);
+			return it != MyHashTable.end() ? it->second : -1;
+		}
+	};
+
+	// Edges and vertices in the order of their dense indices
+	HyperedgeVector MyEdges;
+	VertexVector MyVertices;
+
+	IndexMap MyEdgeIndex;
+	IndexMap MyVertexIndex;
+
+	// Edge -> vertex incidence
+	vector<uint> MyEdgeOffsets;
+	vector<uint> MyEdgeVertices;
+
+	// Vertex -> edge incidence
+	vector<uint> MyVertexOffsets;
+	vector<uint> MyVertexEdges;
+
+	// Edge -> edge adjacency (edges sharing at least one vertex)
+	vector<uint> MyNeighborOffsets;
+	vector<uint> MyEdgeNeighbors;
+
+public:
+	HypergraphCore(const HyperedgeVector &edges, const VertexVector &vertices,
+		const vector<HyperedgeVector> &vertexNeighbors, const vector<HyperedgeVector> &edgeNeighbors);
+
+	size_t nbrOfEdges() const { return MyEdges.size(); }
+	size_t nbrOfVertices() const { return MyVertices.size(); }
+
+	// Returns the dense index of an edge or vertex (-1 if it is not part of the core)
+	int edgeIndex(uint id) const { return MyEdgeIndex[id]; }
+	int vertexIndex(uint id) const { return MyVertexIndex[id]; }
+	int edgeIndex(const HyperedgeSharedPtr &he) const { return MyEdgeIndex[he->getId()]; }
+	int vertexIndex(const VertexSharedPtr &v) const { return MyVertexIndex[v->getId()]; }
+
+	// Returns the edge or vertex stored at a dense index
+	const HyperedgeSharedPtr &edge(uint idx) const { return MyEdges[idx]; }
+	const VertexSharedPtr &vertex(uint idx) const { return MyVertices[idx]; }
+
+	size_t edgeSize(uint idx) const { return MyEdgeOffsets[idx + 1] - MyEdgeOffsets[idx]; }
+	size_t vertexDegree(uint idx) const { return MyVertexOffsets[idx + 1] - MyVertexOffsets[idx]; }
+	size_t nbrOfEdgeNeighbors(uint idx) const { return MyNeighborOffsets[idx + 1] - MyNeighborOffsets[idx]; }
+
+	// Indices of the vertices of an edge
+	Iterable<const uint *> edgeVertices(uint idx) const {
+		return make_iterable(MyEdgeVertices.data() + MyEdgeOffsets[idx], MyEdgeVertices.data() + MyEdgeOffsets[idx + 1]);
+	}
+
+	// Indices of the edges containing a vertex
+	Iterable<const uint *> vertexEdges(uint idx) const {
+		return make_iterable(MyVertexEdges.data() + MyVertexOffsets[idx], MyVertexEdges.data() + MyVertexOffsets[idx + 1]);
+	}
+
+	// Indices of the edges sharing a vertex with an edge
+	Iterable<const uint *> edgeNeighbors(uint idx) const {
+		return make_iterable(MyEdgeNeighbors.data() + MyNeighborOffsets[idx], MyEdgeNeighbors.data() + MyNeighborOffsets[idx + 1]);
+	}
+};
+
+using HypergraphCoreSharedPtr = std::shared_ptr<const HypergraphCore>;
+
+#endif
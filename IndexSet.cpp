@@ -0,0 +1,20 @@
+#include "IndexSet.h"
+
+void IndexSet::reset(uint id)
+{
+	auto it = lower_bound(MyIds.begin(), MyIds.end(), id);
+
+	if (it != MyIds.end() && *it == id)
+		MyIds.erase(it);
+}
+
+bool IndexSet::testAndSet(uint id)
+{
+	auto it = lower_bound(MyIds.begin(), MyIds.end(), id);
+
+	if (it != MyIds.end() && *it == id)
+		return false;
+
+	MyIds.insert(it, id);
+	return true;
+}
@@ -0,0 +1,47 @@
+#pragma once
+// Models a small set of dense integer IDs (e.g., indices of a HypergraphCore).
+// The IDs are kept in a sorted vector, so the memory and the cost of creating and
+// clearing a set depend on the number of elements, not on the size of the hypergraph.
+//
+//////////////////////////////////////////////////////////////////////
+
+#if !defined(CLS_INDEXSET)
+#define CLS_INDEXSET
+
+#include <algorithm>
+#include <vector>
+
+#include "Globals.h"
+
+class IndexSet
+{
+private:
+	// Sorted IDs of the elements
+	vector<uint> MyIds;
+
+public:
+	IndexSet() {}
+
+	// Returns the number of elements
+	size_t size() const { return MyIds.size(); }
+	bool empty() const { return MyIds.empty(); }
+
+	bool test(uint id) const { return binary_search(MyIds.begin(), MyIds.end(), id); }
+	void set(uint id) { testAndSet(id); }
+	void reset(uint id);
+
+	// Inserts id and returns true if it was not contained before
+	bool testAndSet(uint id);
+
+	// Removes all elements
+	void clear() { MyIds.clear(); }
+
+	bool operator==(const IndexSet &other) const { return MyIds == other.MyIds; }
+	bool operator!=(const IndexSet &other) const { return !(*this == other); }
+
+	// Iterates over the elements in increasing order
+	auto begin() const { return MyIds.cbegin(); }
+	auto end() const { return MyIds.cend(); }
+};
+
+#endif
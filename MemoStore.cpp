@@ -0,0 +1,266 @@
+#define _CRT_SECURE_NO_DEPRECATE
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "MemoStore.h"
+#include "Hyperedge.h"
+#include "Vertex.h"
+
+// Magic number at the begin of each store
+static const char cMagic[8] = { 'D', 'K', 'M', 'E', 'M', 'O', '0', '1' };
+
+// Number of pending records that are written to the file at once
+static const size_t cFlushSize = 256;
+
+// Scrambles a hash value (the finalizers of splitmix64 and MurmurHash3)
+static uint64_t mix(uint64_t x)
+{
+	x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+	return x ^ (x >> 31);
+}
+
+static uint64_t mix2(uint64_t x)
+{
+	x = (x ^ (x >> 33)) * 0xff51afd7ed558ccdULL;
+	x = (x ^ (x >> 33)) * 0xc4ceb9fe1a85ec53ULL;
+	return x ^ (x >> 33);
+}
+
+
+void MemoStore::Key::add(uint64_t Value)
+{
+	Lo += mix(Value);
+	Hi += mix2(Value);
+}
+
+MemoStore::MemoStore(const string &File) : MyFileName{ File }
+{
+	load();
+
+	if ((MyFile = fopen(File.c_str(), "ab")) == nullptr)
+		writeErrorMsg("Cannot write memo store \"" + File + "\".", "MemoStore::MemoStore");
+
+	// Records are written in whole blocks, so concurrent runs appending to the store do not mix them
+	setvbuf(MyFile, nullptr, _IONBF, 0);
+	write(nullptr, 0);
+}
+
+MemoStore::~MemoStore()
+{
+	lock_guard<mutex> guard(MyLock);
+	flush();
+	fclose(MyFile);
+}
+
+uint32_t MemoStore::checksum(const Record &R)
+{
+	return (uint32_t)(mix(R.Lo ^ mix2(R.Hi) ^ R.Decomposable) >> 32);
+}
+
+
+/*
+***Description***
+The method loads the records of the store. The file is mapped into memory if possible. Records
+with a wrong checksum are skipped, and so is an incomplete record at the end, which another run
+may still be writing. The file is not changed; an incomplete record of a run that was killed
+while writing is cut off before the next records are appended (see write).
+
+OUTPUT: return: false if the file does not exist or is empty; otherwise true
+*/
+
+bool MemoStore::load()
+{
+	const char *data{ nullptr };
+	size_t size{ 0 };
+	vector<char> file_data;
+
+#if !defined(_WIN32)
+	struct stat file_stat;
+	int file = open(MyFileName.c_str(), O_RDONLY);
+	void *mapped{ MAP_FAILED };
+
+	if (file < 0)
+		return false;
+	if (fstat(file, &file_stat) == 0 && S_ISREG(file_stat.st_mode) && (size = (size_t)file_stat.st_size) > 0)
+		mapped = mmap(NULL, size, PROT_READ, MAP_PRIVATE, file, 0);
+	close(file);
+	if (mapped != MAP_FAILED)
+		data = (const char *)mapped;
+	else
+#endif
+	{
+		// Fallback: read the whole file into memory
+		ifstream in(MyFileName, ios::in | ios::binary);
+		if (!in.is_open())
+			return false;
+		file_data.assign(istreambuf_iterator<char>(in), istreambuf_iterator<char>());
+		data = file_data.data();
+		size = file_data.size();
+	}
+
+	if (size == 0)
+		return false;
+	if (size < sizeof(cMagic) || memcmp(data, cMagic, sizeof(cMagic)) != 0)
+		writeErrorMsg("\"" + MyFileName + "\" is no memo store.", "MemoStore::load");
+
+	size_t nbr_of_records = (size - sizeof(cMagic)) / sizeof(Record);
+	for (size_t i = 0; i < nbr_of_records; i++) {
+		Record rec;
+		memcpy(&rec, data + sizeof(cMagic) + i * sizeof(Record), sizeof(Record));
+		if (rec.Check != checksum(rec))
+			continue;
+
+		Key key;
+		key.Lo = rec.Lo;
+		key.Hi = rec.Hi;
+		MyEntries[key] = rec.Decomposable != 0;
+		MyLoaded++;
+	}
+
+#if !defined(_WIN32)
+	if (mapped != MAP_FAILED)
+		munmap(mapped, size);
+#endif
+
+	return true;
+}
+
+
+
+/*
+***Description***
+The method appends records to the store. Runs sharing the file take an exclusive lock on it
+while writing, so no run finds a record of another one half-written. Holding the lock, an empty
+file gets the magic number, and an incomplete record at the end, left by a run that was killed
+while writing, is cut off, so that the appended records are aligned.
+
+INPUT:	Records: Records to be appended
+		Count: Number of records
+*/
+
+void MemoStore::write(const Record *Records, size_t Count)
+{
+	bool written{ true };
+
+#if !defined(_WIN32)
+	int file = fileno(MyFile);
+	struct stat file_stat;
+
+	flock(file, LOCK_EX);
+	if (fstat(file, &file_stat) == 0 && S_ISREG(file_stat.st_mode)) {
+		size_t size = (size_t)file_stat.st_size;
+		size_t aligned = size < sizeof(cMagic) ? 0 : size - (size - sizeof(cMagic)) % sizeof(Record);
+		if (aligned != size && ftruncate(file, (off_t)aligned) != 0)
+			writeErrorMsg("Cannot repair memo store \"" + MyFileName + "\".", "MemoStore::write");
+		if (aligned == 0)
+			written = fwrite(cMagic, sizeof(cMagic), 1, MyFile) == 1;
+	}
+#else
+	fseek(MyFile, 0, SEEK_END);
+	if (ftell(MyFile) == 0)
+		written = fwrite(cMagic, sizeof(cMagic), 1, MyFile) == 1;
+#endif
+
+	if (written && Count > 0)
+		written = fwrite(Records, sizeof(Record), Count, MyFile) == Count;
+
+#if !defined(_WIN32)
+	flock(file, LOCK_UN);
+#endif
+
+	if (!written)
+		writeErrorMsg("Cannot write memo store \"" + MyFileName + "\".", "MemoStore::write", false);
+}
+
+void MemoStore::flush()
+{
+	if (!MyPending.empty())
+		write(MyPending.data(), MyPending.size());
+	MyPending.clear();
+}
+
+bool MemoStore::lookup(const Key &K, bool &Decomposable)
+{
+	lock_guard<mutex> guard(MyLock);
+	auto it = MyEntries.find(K);
+
+	if (it == MyEntries.end())
+		return false;
+
+	Decomposable = it->second;
+	MyHits++;
+	return true;
+}
+
+void MemoStore::record(const Key &K, bool Decomposable)
+{
+	lock_guard<mutex> guard(MyLock);
+
+	if (!MyEntries.emplace(K, Decomposable).second)
+		return;
+
+	Record rec;
+	rec.Lo = K.Lo;
+	rec.Hi = K.Hi;
+	rec.Decomposable = Decomposable ? 1 : 0;
+	rec.Check = checksum(rec);
+	MyPending.push_back(rec);
+	MyRecorded++;
+
+	if (MyPending.size() >= cFlushSize)
+		flush();
+}
+
+void MemoStore::writeStats(ostream &out) const
+{
+	lock_guard<mutex> guard(MyLock);
+	out << "Memo store: " << MyLoaded << " components loaded, " << MyHits << " found, " << MyRecorded << " recorded." << endl;
+}
+
+uint64_t MemoStore::hashName(const string &Name)
+{
+	// FNV-1a
+	uint64_t h{ 0xcbf29ce484222325ULL };
+
+	for (unsigned char c : Name)
+		h = (h ^ c) * 0x100000001b3ULL;
+
+	return mix(h);
+}
+
+uint64_t MemoStore::hashVertex(const VertexSharedPtr &v)
+{
+	return hashName(v->getName());
+}
+
+uint64_t MemoStore::hashEdge(const HyperedgeSharedPtr &he)
+{
+	uint64_t vertices{ 0 };
+
+	// Subedges share the name prefix of their hyperedge, so the vertices are part of the hash
+	for (auto &v : he->allVertices())
+		vertices += mix(hashVertex(v));
+
+	return mix(hashName(he->getName()) ^ (vertices * 0x9e3779b97f4a7c15ULL));
+}
+
+uint64_t MemoStore::hashHypergraph(const Hypergraph &Hg)
+{
+	uint64_t h{ Hg.getNbrOfEdges() };
+
+	for (auto &he : Hg.allEdges())
+		h += mix2(hashEdge(he));
+
+	return mix(h);
+}
@@ -0,0 +1,103 @@
+#pragma once
+// Models a persistent store of components known to be decomposable or undecomposable. The
+// store is a file of fixed-size records that is mapped into memory when it is opened and
+// appended to while searching, so later runs on the same hypergraph (e.g., with another
+// width, ordering, or seed) start with the results of the earlier ones. Components are
+// identified by a canonical hash of the hypergraph, the edges and connector of the component,
+// the width, and the algorithm. The hash is built from the names of the hyperedges and
+// vertices, since their IDs depend on the order in which they are created.
+//
+//////////////////////////////////////////////////////////////////////
+
+#if !defined(CLS_MEMOSTORE)
+#define CLS_MEMOSTORE
+
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Globals.h"
+#include "Hypergraph.h"
+
+class MemoStore
+{
+public:
+	// Canonical 128-bit hash identifying a component
+	struct Key {
+		uint64_t Lo{ 0 };
+		uint64_t Hi{ 0 };
+
+		// Adds a hash value to the key (the order of the added values does not matter)
+		void add(uint64_t Value);
+
+		bool operator==(const Key &other) const { return Lo == other.Lo && Hi == other.Hi; }
+	};
+
+	struct KeyHash {
+		size_t operator() (const Key &key) const { return (size_t)key.Lo; }
+	};
+
+private:
+	// Record of the file
+	struct Record {
+		uint64_t Lo;
+		uint64_t Hi;
+		uint32_t Decomposable;
+		uint32_t Check;
+	};
+
+	string MyFileName;
+	FILE *MyFile{ nullptr };
+
+	// Results loaded from the file or recorded since
+	unordered_map<Key, bool, KeyHash> MyEntries;
+
+	// Records not yet written to the file
+	vector<Record> MyPending;
+
+	// Number of records loaded from the file, of lookups finding a result, and of recorded results
+	size_t MyLoaded{ 0 };
+	size_t MyHits{ 0 };
+	size_t MyRecorded{ 0 };
+
+	mutable mutex MyLock;
+
+	static uint32_t checksum(const Record &R);
+
+	// Loads the records of the file; returns false if the file does not exist or is empty
+	bool load();
+
+	// Appends records to the file, which is locked meanwhile
+	void write(const Record *Records, size_t Count);
+
+	// Writes the pending records to the file
+	void flush();
+
+public:
+	// Opens the store in the given file (which is created if it does not exist)
+	MemoStore(const string &File);
+	~MemoStore();
+
+	// Looks up a component; returns false if its decomposability is unknown
+	bool lookup(const Key &K, bool &Decomposable);
+
+	// Records the decomposability of a component
+	void record(const Key &K, bool Decomposable);
+
+	// Writes the number of loaded, found, and recorded components
+	void writeStats(ostream &out) const;
+
+	// Returns canonical hash values of a string, a vertex, a hyperedge, and a hypergraph
+	static uint64_t hashName(const string &Name);
+	static uint64_t hashVertex(const VertexSharedPtr &v);
+	static uint64_t hashEdge(const HyperedgeSharedPtr &he);
+	static uint64_t hashHypergraph(const Hypergraph &Hg);
+};
+
+using MemoStoreSharedPtr = std::shared_ptr<MemoStore>;
+
+#endif
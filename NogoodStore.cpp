@@ -0,0 +1,91 @@
+#include <algorithm>
+
+#include "NogoodStore.h"
+#include "SearchStats.h"
+#include "SeparatorCache.h"
+
+uint64_t NogoodStore::signature(const vector<uint> &IDs)
+{
+	uint64_t sig{ 0 };
+
+	for (auto id : IDs)
+		sig |= (uint64_t)1 << (id & 63);
+
+	return sig;
+}
+
+
+/*
+***Description***
+The method checks whether a stored nogood is contained in a component. Only the nogoods
+indexed by an edge of the component can be contained in it; their signatures have to be
+subsets of the signatures of the component before the sorted ID vectors are compared.
+
+INPUT:	Comp: Fingerprint of the component
+		EdgeSig: Signature of the edges of the component
+		ConnectorSig: Signature of the connector of the component
+OUTPUT: return: true if a nogood is contained in Comp; otherwise false
+*/
+
+bool NogoodStore::subsumed(const CompFingerprint &Comp, uint64_t EdgeSig, uint64_t ConnectorSig) const
+{
+	for (auto id : Comp.edges) {
+		auto bucket = MyNogoods.find(id);
+		if (bucket == MyNogoods.end())
+			continue;
+
+		for (auto &nogood : bucket->second)
+			if ((nogood.EdgeSig & ~EdgeSig) == 0 && (nogood.ConnectorSig & ~ConnectorSig) == 0 &&
+				nogood.Comp.edges.size() <= Comp.edges.size() && nogood.Comp.connector.size() <= Comp.connector.size() &&
+				includes(Comp.edges.begin(), Comp.edges.end(), nogood.Comp.edges.begin(), nogood.Comp.edges.end()) &&
+				includes(Comp.connector.begin(), Comp.connector.end(), nogood.Comp.connector.begin(), nogood.Comp.connector.end()))
+				return true;
+	}
+
+	return false;
+}
+
+bool NogoodStore::contains(const CompFingerprint &Comp)
+{
+	uint64_t edge_sig{ signature(Comp.edges) }, connector_sig{ signature(Comp.connector) };
+	lock_guard<mutex> guard(MyLock);
+
+	if (MySize == 0 || !subsumed(Comp, edge_sig, connector_sig))
+		return false;
+
+	MyHits++;
+	return true;
+}
+
+void NogoodStore::insert(const CompFingerprint &Comp)
+{
+	uint64_t edge_sig{ signature(Comp.edges) }, connector_sig{ signature(Comp.connector) };
+	size_t bytes{ CompCache::fingerprintBytes(Comp) + 2 * sizeof(uint64_t) };
+	lock_guard<mutex> guard(MyLock);
+
+	if (Comp.edges.empty() || (MyLimit > 0 && MyBytes + bytes > MyLimit) || subsumed(Comp, edge_sig, connector_sig))
+		return;
+
+	MyNogoods[Comp.edges.front()].push_back({ edge_sig, connector_sig, Comp });
+	MyBytes += bytes;
+	MySize++;
+	SearchStats::addCacheBytes(bytes);
+	SearchStats::count(SearchStats::Counter::NogoodsLearned);
+}
+
+void NogoodStore::clear()
+{
+	lock_guard<mutex> guard(MyLock);
+
+	SearchStats::releaseCacheBytes(MyBytes);
+	MyNogoods.clear();
+	MyBytes = 0;
+	MySize = 0;
+	MyHits = 0;
+}
+
+void NogoodStore::setLimit(size_t Bytes)
+{
+	lock_guard<mutex> guard(MyLock);
+	MyLimit = Bytes;
+}
@@ -0,0 +1,72 @@
+#pragma once
+// Models a store of nogoods, i.e., components known to be undecomposable. If a component C with
+// connector W is undecomposable, so is every component containing the edges of C whose connector
+// contains W, since a decomposition of the larger component restricted to the vertices of C is a
+// decomposition of C. The store therefore answers whether some nogood is contained in a given
+// component. Each nogood is indexed by its smallest edge ID, which has to occur in every component
+// containing it, and carries signatures of its edges and connector vertices (one bit per ID modulo
+// 64), so most nogoods that are not contained are rejected without comparing the ID vectors.
+//
+//////////////////////////////////////////////////////////////////////
+
+#if !defined(CLS_NOGOODSTORE)
+#define CLS_NOGOODSTORE
+
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "Globals.h"
+#include "DecompComponent.h"
+
+class NogoodStore
+{
+private:
+	struct Nogood {
+		// Signatures of the edge IDs and connector vertex IDs
+		uint64_t EdgeSig;
+		uint64_t ConnectorSig;
+		CompFingerprint Comp;
+	};
+
+	// Nogoods indexed by their smallest edge ID
+	unordered_map<uint, vector<Nogood>> MyNogoods;
+
+	// Estimated memory of the nogoods and its limit in bytes (0 if unlimited)
+	size_t MyBytes{ 0 };
+	size_t MyLimit{ 0 };
+
+	// Number of stored nogoods and of components found to contain a nogood
+	size_t MySize{ 0 };
+	size_t MyHits{ 0 };
+
+	mutable mutex MyLock;
+
+	static uint64_t signature(const vector<uint> &IDs);
+
+	// Checks whether a nogood is contained in a component (the lock has to be held)
+	bool subsumed(const CompFingerprint &Comp, uint64_t EdgeSig, uint64_t ConnectorSig) const;
+
+public:
+	NogoodStore() {}
+	~NogoodStore() { clear(); }
+
+	// Checks whether a component contains some nogood and thus is undecomposable
+	bool contains(const CompFingerprint &Comp);
+
+	// Adds an undecomposable component unless it contains a stored nogood; nothing is added once
+	// the limit is reached
+	void insert(const CompFingerprint &Comp);
+
+	// Removes all nogoods and resets the number of hits
+	void clear();
+
+	// Limits the estimated memory of the nogoods (0 if unlimited)
+	void setLimit(size_t Bytes);
+
+	size_t size() const { lock_guard<mutex> guard(MyLock); return MySize; }
+	size_t hits() const { lock_guard<mutex> guard(MyLock); return MyHits; }
+};
+
+#endif
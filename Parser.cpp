@@ -4,9 +4,17 @@
 
 #define _CRT_SECURE_NO_DEPRECATE
 
+#include <algorithm>
 #include <cstdlib>
 #include <cstring>
 
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #include "Parser.h"
 #include "Globals.h"
 
@@ -19,49 +27,120 @@ using namespace std;
 
 Parser::Parser(bool bDef)
 {
-	cMyBuffer[0] = '\0';
-	iMyBufferPos = 0;
+	MyData = MyPos = MyEnd = NULL;
+	MyDataSize = 0;
+	bMyMapped = false;
 	iMyLineNumber = 1;
 	iMyColumnNumber = 0;
 	iMyEndOfAtoms = 0;
 	iMyNbrOfWarnings = 0;
 	bMyEOF = false;
 	bMyDef = bDef;
+	MyAtomVarOffsets.push_back(0);
+	MyAtomVarPos = MyVarAtomPos = MyAtomNeighbourPos = MyVarNeighbourPos = 0;
 }
 
 
 Parser::~Parser()
 {
-	int iDefAtom = 0, iDefVar = 0;
-	vector<set<int> *>::iterator sVectorIter;
-	vector<bool>::iterator bVectorIter;
+	closeFile();
+}
+
 
-	for (sVectorIter=MyAtomVars.begin(); sVectorIter != MyAtomVars.end(); sVectorIter++)
-		delete *sVectorIter;
 
-	for (sVectorIter=MyAtomNeighbours.begin(); sVectorIter != MyAtomNeighbours.end(); sVectorIter++)
-		delete *sVectorIter;
+//////////////////////////////////////////////////////////////////////
+// Class methods
+//////////////////////////////////////////////////////////////////////
 
-	for (sVectorIter=MyVarAtoms.begin(); sVectorIter != MyVarAtoms.end(); sVectorIter++)
-		delete *sVectorIter;
 
-	for (sVectorIter=MyVarNeighbours.begin(); sVectorIter != MyVarNeighbours.end(); sVectorIter++)
-		delete *sVectorIter;
+size_t Parser::TokenHash::operator() (const Token &token) const
+{
+	// FNV-1a
+	size_t hash = 14695981039346656037ULL;
 
-	for (bVectorIter=MyDefAtomUsed.begin(); bVectorIter != MyDefAtomUsed.end(); bVectorIter++, iDefAtom++)
-		if (!*bVectorIter)
-			delete MyDefAtoms[iDefAtom];
+	for (size_t i = 0; i < token.Len; i++) {
+		hash ^= (unsigned char)token.Ptr[i];
+		hash *= 1099511628211ULL;
+	}
 
-	for (bVectorIter=MyDefVarUsed.begin(); bVectorIter != MyDefVarUsed.end(); bVectorIter++, iDefVar++)
-		if (!*bVectorIter)
-			delete MyDefVariables[iDefVar];
+	return hash;
 }
 
 
+char *Parser::Arena::store(const Token &token)
+{
+	char *cIdentifier;
 
-//////////////////////////////////////////////////////////////////////
-// Class methods
-//////////////////////////////////////////////////////////////////////
+	// Start a new chunk if the identifier does not fit into the current one
+	if (MyChunkPos + token.Len + 1 > ARENA_CHUNK_SIZE) {
+		MyChunks.emplace_back(new char[ARENA_CHUNK_SIZE]);
+		MyChunkPos = 0;
+	}
+
+	cIdentifier = MyChunks.back().get() + MyChunkPos;
+	memcpy(cIdentifier, token.Ptr, token.Len);
+	cIdentifier[token.Len] = '\0';
+	MyChunkPos += token.Len + 1;
+
+	return cIdentifier;
+}
+
+
+bool Parser::openFile(const char *cNameOfFile)
+{
+#if !defined(_WIN32)
+	struct stat FileStat;
+	int iFile = open(cNameOfFile, O_RDONLY);
+
+	if (iFile < 0)
+		return false;
+
+	// Map regular files into memory; the tokens then point directly into the file content
+	if (fstat(iFile, &FileStat) == 0 && S_ISREG(FileStat.st_mode)) {
+		MyDataSize = (size_t)FileStat.st_size;
+		if (MyDataSize == 0) {
+			close(iFile);
+			MyData = MyPos = MyEnd = NULL;
+			return true;
+		}
+		void *Data = mmap(NULL, MyDataSize, PROT_READ, MAP_PRIVATE, iFile, 0);
+		if (Data != MAP_FAILED) {
+			close(iFile);
+			bMyMapped = true;
+			MyData = MyPos = (const char *)Data;
+			MyEnd = MyData + MyDataSize;
+			return true;
+		}
+	}
+	close(iFile);
+#endif
+
+	// Fallback: read the whole file into memory
+	ifstream File(cNameOfFile, ios::in | ios::binary);
+	if (!File.is_open())
+		return false;
+
+	MyFileData.assign(istreambuf_iterator<char>(File), istreambuf_iterator<char>());
+	MyDataSize = MyFileData.size();
+	MyData = MyPos = MyFileData.data();
+	MyEnd = MyData + MyDataSize;
+
+	return true;
+}
+
+
+void Parser::closeFile()
+{
+#if !defined(_WIN32)
+	if (bMyMapped)
+		munmap((void *)MyData, MyDataSize);
+#endif
+	bMyMapped = false;
+	MyFileData.clear();
+	MyFileData.shrink_to_fit();
+	MyData = MyPos = MyEnd = NULL;
+	MyDataSize = 0;
+}
 
 
 void Parser::SyntaxError(const char *cMsg, bool bLineNbr) 
@@ -84,23 +163,13 @@ void Parser::SyntaxWarning(const char *cMsg, bool bLineNbr)
 }
 
 
-void Parser::fillBuffer()
+void Parser::endOfFile()
 {
-	if (!MyFile.eof()) {
-		// Reinitialize buffer; this is necessary because of the 'read'-method
-		for(int i=0; i < IF_BUFFER_SIZE; i++)
-			cMyBuffer[i] = '\0';
-
-		MyFile.read(cMyBuffer, IF_BUFFER_SIZE);
-		iMyBufferPos = 0;
-	}
-	else {
-		bMyEOF = true;
+	bMyEOF = true;
 
-		// If end-token was not found yet
-		if (iMyEndOfAtoms == 0)
-			SyntaxError("Unexpected end of file.", true);
-	}
+	// If end-token was not found yet
+	if (iMyEndOfAtoms == 0)
+		SyntaxError("Unexpected end of file.", true);
 }
 
 
@@ -109,32 +178,34 @@ void Parser::readIgnoreText()
 	bool bEndIgnore = false;
 
 	do {
-		switch (cMyBuffer[iMyBufferPos]) {
-			case '\0':	// End of buffer reached -> refill
-				fillBuffer();
-				break;
+		if (MyPos == MyEnd) {  // End of file reached
+			endOfFile();
+			break;
+		}
+
+		switch (*MyPos) {
 			case ' ':	// Ignore spaces
-				++iMyBufferPos;
+				++MyPos;
 				++iMyColumnNumber;
 				break;
 			case 9:		// Ignore tabulators
-				++iMyBufferPos;
+				++MyPos;
 				++iMyColumnNumber;
 				while(iMyColumnNumber%8 != 1)
 					++iMyColumnNumber;
 				break;
 			case '\n':	// Ignore newlines
-				++iMyBufferPos;
+				++MyPos;
 				++iMyLineNumber;
 				iMyColumnNumber = 1;
 				break;
 			case '%':	// Ignore comments
 				do {
-					++iMyBufferPos;
+					++MyPos;
 					++iMyColumnNumber;
-					if (cMyBuffer[iMyBufferPos] == '\0')  // End of buffer reached -> refill
-						fillBuffer();
-				} while ((cMyBuffer[iMyBufferPos] != '\n') && !bMyEOF);
+					if (MyPos == MyEnd)  // End of file reached
+						endOfFile();
+				} while ((current() != '\n') && !bMyEOF);
 				// Until newline or end of file
 				break;
 			default:
@@ -144,45 +215,37 @@ void Parser::readIgnoreText()
 }
 
 
-char *Parser::readIdentifier()
+Parser::Token Parser::readIdentifier()
 {
-	bool bEndIdentifier = false;
-	char cIdentBuffer[MAX_IDENTIFIER_SIZE + 1], *cIdentifier = NULL;
-	int iIdentifierSize = 0;
+	Token Identifier;
+	char c;
 
 	readIgnoreText();
-	do {
-		if (cMyBuffer[iMyBufferPos] == '\0')  // End of buffer reached -> refill
-				fillBuffer();
-		else {
-			if (((cMyBuffer[iMyBufferPos] >= 'A') && (cMyBuffer[iMyBufferPos] <= 'Z')) ||
-				((cMyBuffer[iMyBufferPos] >= 'a') && (cMyBuffer[iMyBufferPos] <= 'z')) ||
-				((cMyBuffer[iMyBufferPos] >= '0') && (cMyBuffer[iMyBufferPos] <= '9')) ||
-				(cMyBuffer[iMyBufferPos] == '_') || (cMyBuffer[iMyBufferPos] == ':')) {
-				
-				// Copy identifier from input file in temporary identifier buffer
-				cIdentBuffer[iIdentifierSize++] = cMyBuffer[iMyBufferPos++];
-				++iMyColumnNumber;
 
-				if (iIdentifierSize > MAX_IDENTIFIER_SIZE)
-					SyntaxError("Maximum length of identifier exceeded.", true);
-			}
-			else
-				bEndIdentifier = true;
+	// The identifier is referenced in place; it ends at the first character that is not allowed in an identifier
+	Identifier.Ptr = MyPos;
+	while (MyPos < MyEnd) {
+		c = *MyPos;
+		if (((c >= 'A') && (c <= 'Z')) || ((c >= 'a') && (c <= 'z')) || ((c >= '0') && (c <= '9')) ||
+			(c == '_') || (c == ':')) {
+			++MyPos;
+			++iMyColumnNumber;
+
+			if (MyPos - Identifier.Ptr > MAX_IDENTIFIER_SIZE)
+				SyntaxError("Maximum length of identifier exceeded.", true);
 		}
-	} while (!bEndIdentifier);
-	// Until character was found that is not allowed in an identifier
+		else
+			break;
+	}
+	Identifier.Len = MyPos - Identifier.Ptr;
 
-	cIdentBuffer[iIdentifierSize] = '\0';
-	if(iIdentifierSize == 0)
-		SyntaxError("Illegal or missing identifier.", true);
+	if (MyPos == MyEnd)
+		endOfFile();
 
-	// Allocate character array for identifier and copy identifier from the identifier buffer in this array
-	cIdentifier = new char[iIdentifierSize + 1];
-	if (cIdentifier == NULL)
-		writeErrorMsg("Error assigning memory.", "Parser::readIdentifier");
+	if(Identifier.Len == 0)
+		SyntaxError("Illegal or missing identifier.", true);
 
-	return strcpy(cIdentifier, cIdentBuffer);
+	return Identifier;
 }
 
 
@@ -192,11 +255,13 @@ bool Parser::readIdentifier(const char *cIdent)
 
 	readIgnoreText();
 	while (cIdent[i] != '\0') {
-		if (cMyBuffer[iMyBufferPos] == '\0')  // End of buffer reached -> refill
-			fillBuffer();
-		if (cMyBuffer[iMyBufferPos] != cIdent[i++])
+		if (MyPos == MyEnd) {  // End of file reached
+			endOfFile();
 			return false;
-		++iMyBufferPos;
+		}
+		if (*MyPos != cIdent[i++])
+			return false;
+		++MyPos;
 		++iMyColumnNumber;
 	}
 
@@ -211,13 +276,15 @@ int Parser::readArity()
 
 	readIgnoreText();
 	do {
-		if (cMyBuffer[iMyBufferPos] == '\0')  // End of buffer reached -> refill
-				fillBuffer();
+		if (MyPos == MyEnd) {  // End of file reached
+			endOfFile();
+			bEndArity = true;
+		}
 		else {
-			if ((cMyBuffer[iMyBufferPos] >= '0') && (cMyBuffer[iMyBufferPos] <= '9')) {
+			if ((*MyPos >= '0') && (*MyPos <= '9')) {
 				iArity *= 10;
-				iArity += (int)cMyBuffer[iMyBufferPos]-48;
-				++iMyBufferPos;
+				iArity += (int)*MyPos-48;
+				++MyPos;
 				++iMyColumnNumber;
 				++iNbrOfDigits;
 
@@ -240,30 +307,24 @@ int Parser::readArity()
 
 void Parser::readVarDefs()
 {
-	char *cIdentifier = NULL, cErrorMsg[MAX_IDENTIFIER_SIZE + 32];
-	vector<char *>::iterator VectorIter;
+	Token Identifier;
+	string sErrorMsg;
 
 	do {
-		cIdentifier = readIdentifier();
+		Identifier = readIdentifier();
 
 		// Check whether the variable is already defined
-		VectorIter = MyDefVariables.begin();
-		while ((VectorIter != MyDefVariables.end()) && (strcmp(*VectorIter, cIdentifier) != 0))
-			++VectorIter;
-
-		// If the variable is not defined yet
-		if (VectorIter == MyDefVariables.end()) {
+		if (MyDefVarIndex.find(Identifier) == MyDefVarIndex.end()) {
 			// Store the variable identifier
-			MyDefVariables.push_back(cIdentifier);
+			MyDefVariables.push_back(MyArena.store(Identifier));
+			MyDefVarIndex.emplace(Token{ MyDefVariables.back(), Identifier.Len }, (int)MyDefVariables.size() - 1);
 
 			// Initialize usage of the variable
 			MyDefVarUsed.push_back(false);
 		}
 		else {
-			strcpy(cErrorMsg, "Variable \"");
-			strcat(cErrorMsg, cIdentifier);
-			strcat(cErrorMsg, "\" is already defined.");
-			SyntaxError(cErrorMsg, true);
+			sErrorMsg = "Variable \"" + string(Identifier.Ptr, Identifier.Len) + "\" is already defined.";
+			SyntaxError(sErrorMsg.c_str(), true);
 		}
 	} while (readSeparator());
 }
@@ -271,26 +332,21 @@ void Parser::readVarDefs()
 
 void Parser::readAtomDefs()
 {
-	char *cIdentifier = NULL, cErrorMsg[MAX_IDENTIFIER_SIZE + 32];
-	vector<char *>::iterator VectorIter;
+	Token Identifier;
+	string sErrorMsg;
 
 	do {
-		cIdentifier = readIdentifier();
+		Identifier = readIdentifier();
 
 		// Check whether the atom is already defined
-		VectorIter = MyDefAtoms.begin();
-		while ((VectorIter != MyDefAtoms.end()) && (strcmp(*VectorIter, cIdentifier) != 0))
-			++VectorIter;
-
-		// If the atom is not defined yet
-		if (VectorIter == MyDefAtoms.end())
-			// Store the variable identifier
-			MyDefAtoms.push_back(cIdentifier);
+		if (MyDefAtomIndex.find(Identifier) == MyDefAtomIndex.end()) {
+			// Store the atom identifier
+			MyDefAtoms.push_back(MyArena.store(Identifier));
+			MyDefAtomIndex.emplace(Token{ MyDefAtoms.back(), Identifier.Len }, (int)MyDefAtoms.size() - 1);
+		}
 		else {
-			strcpy(cErrorMsg, "Atom \"");
-			strcat(cErrorMsg, cIdentifier);
-			strcat(cErrorMsg, "\" is already defined.");
-			SyntaxError(cErrorMsg, true);
+			sErrorMsg = "Atom \"" + string(Identifier.Ptr, Identifier.Len) + "\" is already defined.";
+			SyntaxError(sErrorMsg.c_str(), true);
 		}
 
 		// Read separator between atom identifier and arity
@@ -306,7 +362,6 @@ void Parser::readAtomDefs()
 	} while (readSeparator());
 }
 
-
 bool Parser::readOpenDef()
 {
 	return readIdentifier("<");
@@ -388,61 +443,40 @@ void Parser::readDefinitions()
 
 void Parser::readAtom()
 {
-    char *cIdentifier = NULL;
-	vector<char *>::iterator VectorIter;
-	set<int> *Set = NULL;
-	char cErrorMsg[MAX_IDENTIFIER_SIZE + 64];
+	Token Identifier;
+	SymbolTable::iterator SymbolIter;
+	string sErrorMsg;
 	int iDefAtom = 0, iArity = 0;
 
-	cIdentifier = readIdentifier();
+	Identifier = readIdentifier();
 
 	// Check if the same atom identifier was already used before
-	for (VectorIter=MyAtoms.begin(); VectorIter != MyAtoms.end(); VectorIter++)
-		if (strcmp(*VectorIter, cIdentifier) == 0) {
-			strcpy(cErrorMsg, "Atom identifier \"");
-			strcat(cErrorMsg, cIdentifier);
-			strcat(cErrorMsg, "\" occurs the second time.");
-			SyntaxError(cErrorMsg, true);
-		}
+	if (MyAtomIndex.find(Identifier) != MyAtomIndex.end()) {
+		sErrorMsg = "Atom identifier \"" + string(Identifier.Ptr, Identifier.Len) + "\" occurs the second time.";
+		SyntaxError(sErrorMsg.c_str(), true);
+	}
 
 	if (bMyDef) {
 		// Check whether the atom is defined
-		VectorIter=MyDefAtoms.begin();
-		while ((VectorIter != MyDefAtoms.end()) && (strcmp(*VectorIter, cIdentifier) != 0)) {
-			++VectorIter;
-			++iDefAtom;
-		}
+		SymbolIter = MyDefAtomIndex.find(Identifier);
 
 		// If the atom is not defined
-		if (VectorIter == MyDefAtoms.end()) {
-			strcpy(cErrorMsg, "Undefined atom \"");
-			strcat(cErrorMsg, cIdentifier);
-			strcat(cErrorMsg, "\".");
-			SyntaxError(cErrorMsg, true);
+		if (SymbolIter == MyDefAtomIndex.end()) {
+			sErrorMsg = "Undefined atom \"" + string(Identifier.Ptr, Identifier.Len) + "\".";
+			SyntaxError(sErrorMsg.c_str(), true);
 		}
+		iDefAtom = SymbolIter->second;
 
 		// Update atom usage
 		MyDefAtomUsed[iDefAtom] = true;
 
 		// Store the atom identifier
 		MyAtoms.push_back(MyDefAtoms[iDefAtom]);
-		delete cIdentifier;
 	}
 	else
 		// Store the atom identifier
-		MyAtoms.push_back(cIdentifier);
-
-	// Allocate a set of variables for the atom
-	Set = new set<int>;
-	if (Set == NULL)
-		writeErrorMsg("Error assigning memory.", "Parser::readAtom");
-	MyAtomVars.push_back(Set);
-
-	// Allocate a set of neighbours for the atom
-	Set = new set<int>;
-	if (Set == NULL)
-		writeErrorMsg("Error assigning memory.", "Parser::readAtom");
-	MyAtomNeighbours.push_back(Set);
+		MyAtoms.push_back(MyArena.store(Identifier));
+	MyAtomIndex.emplace(Token{ MyAtoms.back(), Identifier.Len }, (int)MyAtoms.size() - 1);
 
 	// Read the atom body
 	readOpenBody();
@@ -452,6 +486,10 @@ void Parser::readAtom()
 	} while (readSeparator());
 	readCloseBody();
 
+	// Close the variable list of the atom and sort it
+	sort(MyAtomVarList.begin() + MyAtomVarOffsets.back(), MyAtomVarList.end());
+	MyAtomVarOffsets.push_back((int)MyAtomVarList.size());
+
 	// Check whether the number of arguments equals the defined arity
 	if (bMyDef && (MyArities[iDefAtom] != iArity))
 		SyntaxError("Illegal number of arguments.", true);
@@ -461,110 +499,69 @@ void Parser::readAtom()
 void Parser::readVariable()
 {
 	int iVar, iDefVar, iAtom;
-	char *cIdentifier = NULL;
-	vector<char *>::iterator VectorIter;
-	set<int>::iterator SetIter;
-	set<int> *Set = NULL;
-	pair<set<int>::iterator, bool> SetInsertRet;
-	char cErrorMsg[(2*MAX_IDENTIFIER_SIZE) + 64];
+	Token Identifier;
+	SymbolTable::iterator SymbolIter;
+	string sErrorMsg;
 
 	iAtom = (int)MyAtoms.size()-1;
-	cIdentifier = readIdentifier();
+	Identifier = readIdentifier();
 
 	// Check if the same variable was already used before
-	iVar = iDefVar = 0;
-	VectorIter = MyVariables.begin();
-	while ((VectorIter != MyVariables.end()) && (strcmp(*VectorIter, cIdentifier) != 0)) {
-		++VectorIter;
-		++iVar;
-	}
+	SymbolIter = MyVarIndex.find(Identifier);
 
 	// If the variable did not occur previously
-    if (VectorIter == MyVariables.end()) {
+	if (SymbolIter == MyVarIndex.end()) {
 
 		if (bMyDef) {
 			// Check whether the variable is defined
-			VectorIter = MyDefVariables.begin();
-			while ((VectorIter != MyDefVariables.end()) && (strcmp(*VectorIter, cIdentifier) != 0)) {
-				++VectorIter;
-				++iDefVar;
-			}
+			SymbolIter = MyDefVarIndex.find(Identifier);
 
 			// If the variable is not defined
-			if (VectorIter == MyDefVariables.end()) {
-				strcpy(cErrorMsg, "Undefined variable \"");
-				strcat(cErrorMsg, cIdentifier);
-				strcat(cErrorMsg, "\".");
-				SyntaxError(cErrorMsg, true);
+			if (SymbolIter == MyDefVarIndex.end()) {
+				sErrorMsg = "Undefined variable \"" + string(Identifier.Ptr, Identifier.Len) + "\".";
+				SyntaxError(sErrorMsg.c_str(), true);
 			}
+			iDefVar = SymbolIter->second;
 
 			// Update variable usage
 			MyDefVarUsed[iDefVar] = true;
 
 			// Store the variable identifier
 			MyVariables.push_back(MyDefVariables[iDefVar]);
-			delete cIdentifier;
 		}
 		else
 			// Store the variable identifier
-			MyVariables.push_back(cIdentifier);
-
-		// Allocate a set of atoms for the variable
-		Set = new set<int>;
-		if (Set == NULL)
-			writeErrorMsg("Error assigning memory.", "Parser::readVariable");
-		MyVarAtoms.push_back(Set);
-
-		// Allocate a set of neighbours for the variable
-		Set = new set<int>;
-		if (Set == NULL)
-			writeErrorMsg("Error assigning memory.", "Parser::readVariable");
-		MyVarNeighbours.push_back(Set);
+			MyVariables.push_back(MyArena.store(Identifier));
+		iVar = (int)MyVariables.size() - 1;
+		MyVarIndex.emplace(Token{ MyVariables.back(), Identifier.Len }, iVar);
+
+		MyVarLastAtom.push_back(-1);
 	}
+	else
+		iVar = SymbolIter->second;
 
-	// Add variable to the set of variables of the actual atom
-    SetInsertRet = MyAtomVars[iAtom]->insert(iVar);
 	// Write syntax warning if the variable occurs multiple times in the actual atom
-	if (SetInsertRet.second == false) {
-		strcpy(cErrorMsg, "Multiple occurrences of variable \"");
-		strcat(cErrorMsg, cIdentifier);
-		strcat(cErrorMsg, "\" in atom \"");
-		strcat(cErrorMsg, MyAtoms.back());
-		strcat(cErrorMsg, "\".");
-		SyntaxWarning(cErrorMsg, true);
+	if (MyVarLastAtom[iVar] == iAtom) {
+		sErrorMsg = "Multiple occurrences of variable \"" + string(Identifier.Ptr, Identifier.Len) + 
+			"\" in atom \"" + MyAtoms.back() + "\".";
+		SyntaxWarning(sErrorMsg.c_str(), true);
+	}
+	else {
+		// Add variable to the variables of the actual atom
+		MyVarLastAtom[iVar] = iAtom;
+		MyAtomVarList.push_back(iVar);
 	}
-
-	// Update the neighbourhood relation between the actual atom and the atoms already stored before
-	for (SetIter=MyVarAtoms[iVar]->begin(); SetIter != MyVarAtoms[iVar]->end(); SetIter++)
-		if (*SetIter != iAtom) {
-			MyAtomNeighbours[*SetIter]->insert(iAtom);
-			MyAtomNeighbours[iAtom]->insert(*SetIter);
-		}
-
-	// Update the neighbourhood relation between the actual variable and the variables already stored before
-	for (SetIter=MyAtomVars[iAtom]->begin(); SetIter != MyAtomVars[iAtom]->end(); SetIter++)
-		if (*SetIter != iVar) {
-			MyVarNeighbours[*SetIter]->insert(iVar);
-			MyVarNeighbours[iVar]->insert(*SetIter);
-		}
-
-	// Add actual atom to the set of atoms of the variable
- 	MyVarAtoms[iVar]->insert(iAtom);
 }
 
 
 void Parser::parseFile(const char *cNameOfFile)
 {
 	int iDefVar = 0, iDefAtom = 0;
-	char cErrorMsg[96], cLineNumber[(sizeof(int)*8)+1];
+	char cErrorMsg[MAX_IDENTIFIER_SIZE + 96], cLineNumber[(sizeof(int)*8)+1];
 	vector<bool>::iterator bVectorIter;
-	vector<char *>::iterator cVectorIter;
 
-	// Open input file stream
-	MyFile.open(cNameOfFile, ios::in);
-
-	// Check if file opening was successful
-	if(!MyFile.is_open())
+	// Map the input file into memory
+	if(!openFile(cNameOfFile))
 		SyntaxError("Error opening file.");
 
 	// Read definitions of variables and relations
@@ -572,12 +569,10 @@ void Parser::parseFile(const char *cNameOfFile)
 
 	// Delete all definition informations
 	if (!bMyDef) {
-		for (cVectorIter=MyDefAtoms.begin(); cVectorIter != MyDefAtoms.end(); cVectorIter++)
-			delete *cVectorIter;
-		for (cVectorIter=MyDefVariables.begin(); cVectorIter != MyDefVariables.end(); cVectorIter++)
-			delete *cVectorIter;
 		MyDefAtoms.clear();
 		MyDefVariables.clear();
+		MyDefAtomIndex.clear();
+		MyDefVarIndex.clear();
 		MyArities.clear();
 		MyDefAtomUsed.clear();
 		MyDefVarUsed.clear();
@@ -592,8 +587,8 @@ void Parser::parseFile(const char *cNameOfFile)
 	// Read the text after the end-token
 	readIgnoreText();
 
-	// Close input file stream
-	MyFile.close();
+	// Release the input file (all identifiers are stored in the arena)
+	closeFile();
 
 	// Write syntax warning if EOF does not appear during reading the ignore text, i.e., there appears
 	// some text after the end-token was found
@@ -642,45 +637,51 @@ int Parser::getNbrOfVars() const
 
 int Parser::getNbrOfVars(int iAtom) const
 {
-	if (iAtom >= (int)MyAtomVars.size()) {
+	if (iAtom >= (int)MyAtoms.size()) {
 		writeErrorMsg("Position not available.", "Parser::getNbrOfVars");
 		return 0;
 	}
 	else
-		return (int)MyAtomVars[iAtom]->size();
+		return MyAtomVarOffsets[iAtom+1] - MyAtomVarOffsets[iAtom];
 }
 
 
 int Parser::getNbrOfAtoms(int iVar) const
 {
-	if (iVar >= (int)MyVarAtoms.size()) {
+	if (iVar >= (int)MyVariables.size()) {
 		writeErrorMsg("Position not available.", "Parser::getNbrOfAtoms");
 		return 0;
 	}
-	else
-		return (int)MyVarAtoms[iVar]->size();
+	else {
+		buildVarAtoms();
+		return MyVarAtomOffsets[iVar+1] - MyVarAtomOffsets[iVar];
+	}
 }
 
 
 int Parser::getNbrOfAtomNeighbours(int iAtom) const
 {
-	if (iAtom >= (int)MyAtomNeighbours.size()) {
+	if (iAtom >= (int)MyAtoms.size()) {
 		writeErrorMsg("Position not available.", "Parser::getNbrOfAtomNeighbours");
 		return 0;
 	}
-	else
-		return (int)MyAtomNeighbours[iAtom]->size();
+	else {
+		buildNeighbours();
+		return MyAtomNeighbourOffsets[iAtom+1] - MyAtomNeighbourOffsets[iAtom];
+	}
 }
 
 
 int Parser::getNbrOfVarNeighbours(int iVar) const
 {
-	if (iVar >= (int)MyVarNeighbours.size()) {
+	if (iVar >= (int)MyVariables.size()) {
 		writeErrorMsg("Position not available.", "Parser::getNbrOfVarNeighbours");
 		return 0;
 	}
-	else
-		return (int)MyVarNeighbours[iVar]->size();
+	else {
+		buildNeighbours();
+		return MyVarNeighbourOffsets[iVar+1] - MyVarNeighbourOffsets[iVar];
+	}
 }
 
 
@@ -712,110 +713,127 @@ char *Parser::getVariable(int iVar) const
 }
 
 
-int Parser::getNextAtomVar(bool bReset)
+void Parser::buildVarAtoms() const
 {
-	static vector<set<int> *>::iterator VectorIter;
-	static set<int>::iterator SetIter;
-	static bool bFirstCall = true;
-
-	// Initialize resp. reset the iterator
-	if(bFirstCall || bReset) {
-		VectorIter = MyAtomVars.begin();
-		if(VectorIter == MyAtomVars.end())
-			writeErrorMsg("Position not available.", "Parser::getNextAtomVar");
-		SetIter = (*VectorIter)->begin();
-		bFirstCall = false;
+	size_t iNbrOfVars = MyVariables.size();
+	vector<int> Pos;
+
+	if (!MyVarAtomOffsets.empty())
+		return;
+
+	// Count the atoms of each variable and compute the offsets
+	MyVarAtomOffsets.assign(iNbrOfVars + 1, 0);
+	for (auto iVar : MyAtomVarList)
+		++MyVarAtomOffsets[iVar + 1];
+	for (size_t iVar = 0; iVar < iNbrOfVars; iVar++)
+		MyVarAtomOffsets[iVar + 1] += MyVarAtomOffsets[iVar];
+
+	// Scanning the atoms in increasing order yields sorted atom lists
+	Pos.assign(MyVarAtomOffsets.begin(), MyVarAtomOffsets.end() - 1);
+	MyVarAtomList.resize(MyAtomVarList.size());
+	for (size_t iAtom = 0; iAtom < MyAtoms.size(); iAtom++)
+		for (int i = MyAtomVarOffsets[iAtom]; i < MyAtomVarOffsets[iAtom + 1]; i++)
+			MyVarAtomList[Pos[MyAtomVarList[i]]++] = (int)iAtom;
+}
+
+
+void Parser::buildNeighbours() const
+{
+	vector<int> Stamps;
+	size_t iFirst;
+
+	if (!MyAtomNeighbourOffsets.empty())
+		return;
+
+	buildVarAtoms();
+
+	// Atoms are neighbours if they have a common variable
+	Stamps.assign(MyAtoms.size(), -1);
+	MyAtomNeighbourOffsets.push_back(0);
+	for (int iAtom = 0; iAtom < (int)MyAtoms.size(); iAtom++) {
+		iFirst = MyAtomNeighbourList.size();
+		Stamps[iAtom] = iAtom;
+		for (int i = MyAtomVarOffsets[iAtom]; i < MyAtomVarOffsets[iAtom + 1]; i++)
+			for (int j = MyVarAtomOffsets[MyAtomVarList[i]]; j < MyVarAtomOffsets[MyAtomVarList[i] + 1]; j++)
+				if (Stamps[MyVarAtomList[j]] != iAtom) {
+					Stamps[MyVarAtomList[j]] = iAtom;
+					MyAtomNeighbourList.push_back(MyVarAtomList[j]);
+				}
+		sort(MyAtomNeighbourList.begin() + iFirst, MyAtomNeighbourList.end());
+		MyAtomNeighbourOffsets.push_back((int)MyAtomNeighbourList.size());
 	}
-	else
-		++SetIter;  // Increment the iterator
 
-	while(SetIter == (*VectorIter)->end()) {
-		if(++VectorIter == MyAtomVars.end())
-			writeErrorMsg("Position not available.", "Parser::getNextAtomVar");
-		SetIter = (*VectorIter)->begin();
+	// Variables are neighbours if they occur in a common atom
+	Stamps.assign(MyVariables.size(), -1);
+	MyVarNeighbourOffsets.push_back(0);
+	for (int iVar = 0; iVar < (int)MyVariables.size(); iVar++) {
+		iFirst = MyVarNeighbourList.size();
+		Stamps[iVar] = iVar;
+		for (int i = MyVarAtomOffsets[iVar]; i < MyVarAtomOffsets[iVar + 1]; i++)
+			for (int j = MyAtomVarOffsets[MyVarAtomList[i]]; j < MyAtomVarOffsets[MyVarAtomList[i] + 1]; j++)
+				if (Stamps[MyAtomVarList[j]] != iVar) {
+					Stamps[MyAtomVarList[j]] = iVar;
+					MyVarNeighbourList.push_back(MyAtomVarList[j]);
+				}
+		sort(MyVarNeighbourList.begin() + iFirst, MyVarNeighbourList.end());
+		MyVarNeighbourOffsets.push_back((int)MyVarNeighbourList.size());
 	}
+}
+
+
+int Parser::getNextAtomVar(bool bReset)
+{
+	// Initialize resp. reset the position
+	if(bReset)
+		MyAtomVarPos = 0;
+
+	if(MyAtomVarPos >= MyAtomVarList.size())
+		writeErrorMsg("Position not available.", "Parser::getNextAtomVar");
 
-	return *SetIter;  // Return the next neighbour index
+	return MyAtomVarList[MyAtomVarPos++];  // Return the next variable index
 }
 
 
 int Parser::getNextVarAtom(bool bReset) 
 {
-	static vector<set<int> *>::iterator VectorIter;
-	static set<int>::iterator SetIter;
-	static bool bFirstCall = true;
-
-	// Initialize resp. reset the iterator
-	if(bFirstCall || bReset) {
-		VectorIter = MyVarAtoms.begin();
-		if(VectorIter == MyVarAtoms.end())
-			writeErrorMsg("Position not available.", "Parser::getNextVarAtom");
-		SetIter = (*VectorIter)->begin();
-		bFirstCall = false;
-	}
-	else
-		++SetIter;  // Increment the iterator
+	buildVarAtoms();
 
-	while(SetIter == (*VectorIter)->end()) {
-		if(++VectorIter == MyVarAtoms.end())
-			writeErrorMsg("Position not available.", "Parser::getNextVarAtom");
-		SetIter = (*VectorIter)->begin();
-	}
+	// Initialize resp. reset the position
+	if(bReset)
+		MyVarAtomPos = 0;
+
+	if(MyVarAtomPos >= MyVarAtomList.size())
+		writeErrorMsg("Position not available.", "Parser::getNextVarAtom");
 
-	return *SetIter;  // Return the next neighbour index
+	return MyVarAtomList[MyVarAtomPos++];  // Return the next atom index
 }
 
 
 int Parser::getNextAtomNeighbour(bool bReset)
 {
-	static vector<set<int> *>::iterator VectorIter;
-	static set<int>::iterator SetIter;
-	static bool bFirstCall = true;
-
-	// Initialize resp. reset the iterator
-	if(bFirstCall || bReset) {
-		VectorIter = MyAtomNeighbours.begin();
-		if(VectorIter == MyAtomNeighbours.end())
-			writeErrorMsg("Position not available.", "Parser::getNextAtomNeighbour");
-		SetIter = (*VectorIter)->begin();
-		bFirstCall = false;
-	}
-	else
-		++SetIter;  // Increment the iterator
+	buildNeighbours();
 
-	while(SetIter == (*VectorIter)->end()) {
-		if(++VectorIter == MyAtomNeighbours.end())
-			writeErrorMsg("Position not available.", "Parser::getNextAtomNeighbour");
-		SetIter = (*VectorIter)->begin();
-	}
+	// Initialize resp. reset the position
+	if(bReset)
+		MyAtomNeighbourPos = 0;
+
+	if(MyAtomNeighbourPos >= MyAtomNeighbourList.size())
+		writeErrorMsg("Position not available.", "Parser::getNextAtomNeighbour");
 
-	return *SetIter;  // Return the next neighbour index
+	return MyAtomNeighbourList[MyAtomNeighbourPos++];  // Return the next neighbour index
 }
 
 
 int Parser::getNextVarNeighbour(bool bReset)
 {
-	static vector<set<int> *>::iterator VectorIter;
-	static set<int>::iterator SetIter;
-	static bool bFirstCall = true;
-
-	// Initialize resp. reset the iterator
-	if(bFirstCall || bReset) {
-		VectorIter = MyVarNeighbours.begin();
-		if(VectorIter == MyVarNeighbours.end())
-			writeErrorMsg("Position not available.", "Parser::getNextVarNeighbour");
-		SetIter = (*VectorIter)->begin();
-		bFirstCall = false;
-	}
-	else
-		++SetIter;  // Increment the iterator
+	buildNeighbours();
 
-	while(SetIter == (*VectorIter)->end()) {
-		if(++VectorIter == MyVarNeighbours.end())
-			writeErrorMsg("Position not available.", "Parser::getNextVarNeighbour");
-		SetIter = (*VectorIter)->begin();
-	}
+	// Initialize resp. reset the position
+	if(bReset)
+		MyVarNeighbourPos = 0;
 
-	return *SetIter;  // Return the next neighbour index
-}
+	if(MyVarNeighbourPos >= MyVarNeighbourList.size())
+		writeErrorMsg("Position not available.", "Parser::getNextVarNeighbour");
 
+	return MyVarNeighbourList[MyVarNeighbourPos++];  // Return the next neighbour index
+}
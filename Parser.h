@@ -1,35 +1,71 @@
 // Models a parser for parsing the hypergraph given in an appropriate file format 
 // and stores the information in preliminary data structures.
 //
+// The input file is mapped into memory (or read as a whole where mapping is not possible)
+// and tokenized in place; this replaces the former reading through a 1024-byte buffer.
+// The accepted syntax, the stored identifiers and the positions reported in errors and
+// warnings are the same as before. Identifiers are looked up in hash tables, and only
+// their first occurrence is copied into an arena.
+//
 //////////////////////////////////////////////////////////////////////
 
 
 #if !defined(CLS_PARSER)
 #define CLS_PARSER
 
+#include <cstring>
 #include <iostream>
 #include <fstream>
 #include <vector>
 #include <set>
+#include <memory>
+#include <unordered_map>
 
 using namespace std;
 
 
-#define IF_BUFFER_SIZE 1024
 #define MAX_IDENTIFIER_SIZE 128
+#define ARENA_CHUNK_SIZE 65536
 
 
 class Parser 
 {
 private:
-	// Input file stream
-    ifstream MyFile;
-
-	// Internal buffer for file data
-	char cMyBuffer[IF_BUFFER_SIZE];
-
-	// Current position in the internal buffer cMyBuffer
-	int iMyBufferPos;
+	// Reference to an identifier (not necessarily null-terminated)
+	struct Token {
+		const char *Ptr;
+		size_t Len;
+
+		bool operator==(const Token &other) const { return Len == other.Len && memcmp(Ptr, other.Ptr, Len) == 0; }
+	};
+
+	struct TokenHash {
+		size_t operator() (const Token &token) const;
+	};
+
+	// Stores the identifiers as null-terminated strings in large chunks of memory
+	class Arena {
+	private:
+		vector<unique_ptr<char[]>> MyChunks;
+		size_t MyChunkPos{ ARENA_CHUNK_SIZE };
+
+	public:
+		// Copies the token into the arena and returns the null-terminated copy
+		char *store(const Token &token);
+	};
+
+	// Maps identifiers to their positions in the corresponding vector
+	using SymbolTable = unordered_map<Token, int, TokenHash>;
+
+	// Content of the input file (memory-mapped if possible, otherwise read into MyFileData)
+	const char *MyData;
+	size_t MyDataSize;
+	vector<char> MyFileData;
+	bool bMyMapped;
+
+	// Current position in the input and end of the input
+	const char *MyPos;
+	const char *MyEnd;
 
 	// Current line number in the input file
 	int iMyLineNumber;
@@ -49,11 +85,16 @@ private:
 	// Boolean value indicating whether definitions have to be checked
 	bool bMyDef;
 
+	// Storage of all identifiers
+	Arena MyArena;
+
 	// Pointers to the atom identifiers
 	vector<char *> MyDefAtoms;
+	SymbolTable MyDefAtomIndex;
 
 	// Pointers to the variable identifiers
 	vector<char *> MyDefVariables;
+	SymbolTable MyDefVarIndex;
 
 	// Arities of the atoms
 	vector<int> MyArities;
@@ -66,25 +107,47 @@ private:
 
 	// Pointers to the atom identifiers
 	vector<char *> MyAtoms;
+	SymbolTable MyAtomIndex;
 
 	// Pointers to the variable identifiers
 	vector<char *> MyVariables;
+	SymbolTable MyVarIndex;
+
+	// Variables of the atoms as flat incidence list; the variables of the i-th atom are 
+	// stored (in increasing order) from MyAtomVarOffsets[i] to MyAtomVarOffsets[i+1]-1
+	vector<int> MyAtomVarOffsets;
+	vector<int> MyAtomVarList;
+
+	// Last atom in which a variable occurred (to detect multiple occurrences within an atom)
+	vector<int> MyVarLastAtom;
+
+	// Current positions of the getNext...-methods
+	size_t MyAtomVarPos, MyVarAtomPos, MyAtomNeighbourPos, MyVarNeighbourPos;
+
+	// Atoms to which the variables belong, computed on demand from the incidence list
+	mutable vector<int> MyVarAtomOffsets;
+	mutable vector<int> MyVarAtomList;
+
+	// Neighbour atoms of the atoms resp. neighbour variables of the variables, computed on demand
+	mutable vector<int> MyAtomNeighbourOffsets;
+	mutable vector<int> MyAtomNeighbourList;
+	mutable vector<int> MyVarNeighbourOffsets;
+	mutable vector<int> MyVarNeighbourList;
+
+	// Computes the atoms to which the variables belong
+	void buildVarAtoms() const;
 
-	// Pointers to sets of variables belonging to an atom;
-	// the numbers in the sets refer to variables in MyVariables
-	vector<set<int> *> MyAtomVars;
+	// Computes the neighbourhood relations of atoms and variables
+	void buildNeighbours() const;
 
-	// Pointers to sets of neighbour atoms belonging to an atom;
-	// the numbers in the sets refer to atoms in MyAtoms
-	vector<set<int> *> MyAtomNeighbours;
+	// Maps the input file into memory (or reads it if mapping is not possible)
+	bool openFile(const char *cNameOfFile);
 
-	// Pointers to sets of atoms to which a variable belongs;
-	// the numbers in the sets refer to atoms in MyAtoms
-	vector<set<int> *> MyVarAtoms;
+	// Releases the content of the input file
+	void closeFile();
 
-	// Pointers to sets of neighbour variables belonging to a variable;
-	// the numbers in the sets refer to variables in MyVariables
-	vector<set<int> *> MyVarNeighbours;
+	// Returns the current character or '\0' at the end of the input
+	char current() const { return MyPos < MyEnd ? *MyPos : '\0'; }
 
    	// Writes a standardized syntax error message to the standard output and aborts the program
 	void SyntaxError(const char *cMsg, bool bLineNbr = false);
@@ -92,14 +155,14 @@ private:
 	// Writes a standardized syntax warning message to the standard output and continues the program
 	void SyntaxWarning(const char *cMsg, bool bLineNbr = false);
 
-	// Fills the internal file buffer cMyBuffer
-	void fillBuffer();
+	// Handles the end of the input file
+	void endOfFile();
 
 	// Reads text from the input file that can be ignored (e.g., space, newline, ...)
 	void readIgnoreText();
 
 	// Reads an identifier (i.e., name of an atom or a variable) from the input file
-	char *readIdentifier();
+	Token readIdentifier();
 
 	// Reads an identifier given as argument
 	bool readIdentifier(const char *cIdent);
@@ -163,6 +226,7 @@ public:
 	int getNbrOfAtoms(int iVar) const;
 
 	// Returns the number of atoms that are neighbours (i.e., have common variables) of a given atom
+	// (the neighbourhood relations are computed on first use)
     int getNbrOfAtomNeighbours(int iAtom) const;
 
 	// Returns the number of variables that are neighbours (i.e., have common atoms) of a given variable
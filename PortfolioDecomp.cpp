@@ -0,0 +1,173 @@
+#include <atomic>
+#include <cstdlib>
+#include <mutex>
+
+#include "PortfolioDecomp.h"
+#include "DetKDecomp.h"
+#include "BalKDecomp.h"
+#include "WorkStealingPool.h"
+
+PortfolioDecomp::PortfolioDecomp(const HypergraphSharedPtr &HGraph, int k) : Decomp(HGraph, k)
+{
+}
+
+PortfolioDecomp::~PortfolioDecomp()
+{
+}
+
+/*
+***Description***
+The method adds a configuration to the race. BalKDecomp keeps its caches in static members,
+so at most one configuration may run balsep.
+
+INPUT:	C: Configuration
+*/
+
+void PortfolioDecomp::addConfig(const Config &C)
+{
+	unique_ptr<Decomp> decomp;
+
+	switch (C.Alg) {
+	case Algorithm::BalSep:
+		for (auto &config : MyConfigs)
+			if (config.Alg == Algorithm::BalSep)
+				writeErrorMsg("At most one configuration may run balsep.", "PortfolioDecomp::addConfig");
+		BalKDecomp::init(MyHg, 0);
+		BalKDecomp::setCacheLimit(MyCacheLimit);
+		decomp = make_unique<BalKDecomp>(MyHg, MyK);
+		break;
+	default:
+		auto detk = make_unique<DetKDecomp>(MyHg, MyK, C.Alg == Algorithm::LocalBIP);
+		detk->setCacheLimit(MyCacheLimit);
+		decomp = move(detk);
+	}
+
+	decomp->setEdgeOrder(C.Order);
+	MyConfigs.push_back(C);
+	MyDecomps.push_back(move(decomp));
+}
+
+HypertreeSharedPtr PortfolioDecomp::buildHypertree()
+{
+	return buildRootedHypertree(VertexSet());
+}
+
+/*
+***Description***
+The method runs all configurations concurrently, each one in a task group of its own. The
+first configuration finding a decomposition cancels all other groups. A configuration failing
+without being interrupted has searched the whole search space of its algorithm, so the
+configurations running the same algorithm with other orderings are cancelled as well.
+
+INPUT:	Root: Vertices to be covered by the root of the hypertree
+OUTPUT: return: Hypertree of the first configuration finding one (nullptr if none does)
+*/
+
+HypertreeSharedPtr PortfolioDecomp::buildRootedHypertree(const VertexSet &Root)
+{
+	size_t cnt_configs{ MyConfigs.size() };
+	HypertreeSharedPtr htree{ nullptr };
+	atomic<bool> found{ false };
+	mutex lock;
+
+	MyWinner = -1;
+	if (cnt_configs == 0)
+		return nullptr;
+
+	WorkStealingPool pool(cnt_configs);
+	vector<unique_ptr<TaskGroup>> groups;
+	for (size_t i = 0; i < cnt_configs; i++)
+		groups.push_back(make_unique<TaskGroup>(pool));
+
+	for (size_t i = 0; i < cnt_configs; i++) {
+		MyDecomps[i]->setBudget(MyBudget);
+		groups[i]->run([&, i] {
+			if (MyConfigs[i].Seed != 0)
+				seed_random_thread(MyConfigs[i].Seed);
+
+			HypertreeSharedPtr result = MyDecomps[i]->buildRootedHypertree(Root);
+
+			// The thread may run other configurations (or be the calling thread) afterwards
+			if (MyConfigs[i].Seed != 0)
+				restore_random_thread();
+
+			lock_guard<mutex> guard(lock);
+			if (result != nullptr && !found.exchange(true)) {
+				htree = result;
+				MyWinner = (int)i;
+				for (auto &group : groups)
+					group->cancel();
+			}
+			else if (result == nullptr && !interrupted())
+				for (size_t j = 0; j < cnt_configs; j++)
+					if (MyConfigs[j].Alg == MyConfigs[i].Alg)
+						groups[j]->cancel();
+		});
+	}
+
+	for (auto &group : groups)
+		group->wait();
+
+	return htree;
+}
+
+void PortfolioDecomp::setWidth(int k)
+{
+	for (auto &decomp : MyDecomps)
+		decomp->setWidth(k);
+
+	Decomp::setWidth(k);
+}
+
+bool PortfolioDecomp::parseConfig(const string &Spec, Config &C)
+{
+	size_t first = Spec.find(':'), second = first == string::npos ? string::npos : Spec.find(':', first + 1);
+	string alg = Spec.substr(0, first);
+
+	if (alg == "det")
+		C.Alg = Algorithm::DetK;
+	else if (alg == "localbip")
+		C.Alg = Algorithm::LocalBIP;
+	else if (alg == "balsep")
+		C.Alg = Algorithm::BalSep;
+	else
+		return false;
+
+	C.Order = EdgeOrder::MCS;
+	C.Seed = 0;
+	if (first == string::npos)
+		return true;
+
+	if (!parseEdgeOrder(Spec.substr(first + 1, second == string::npos ? string::npos : second - first - 1), C.Order))
+		return false;
+	if (second == string::npos)
+		return true;
+
+	string seed = Spec.substr(second + 1);
+	char *end;
+	C.Seed = (unsigned int)strtoul(seed.c_str(), &end, 10);
+
+	return !seed.empty() && *end == '\0';
+}
+
+string PortfolioDecomp::getConfigName(const Config &C)
+{
+	string name;
+
+	switch (C.Alg) {
+	case Algorithm::BalSep:
+		name = "balsep";
+		break;
+	case Algorithm::LocalBIP:
+		name = "localbip";
+		break;
+	default:
+		name = "det";
+	}
+
+	name += ":" + getEdgeOrderName(C.Order);
+	if (C.Seed != 0)
+		name += ":" + to_string(C.Seed);
+
+	return name;
+}
@@ -0,0 +1,79 @@
+#pragma once
+// Races several configurations (algorithm, ordering of the hyperedges, and random seed) of
+// the decomposition algorithms on the same hypergraph. Each configuration runs on its own
+// thread; the first decomposition found is returned and all other searches are cancelled.
+//
+//////////////////////////////////////////////////////////////////////
+
+#if !defined(CLS_PORTFOLIODECOMP)
+#define CLS_PORTFOLIODECOMP
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Globals.h"
+#include "Decomp.h"
+
+class PortfolioDecomp : public Decomp
+{
+public:
+	// Algorithms that can be raced
+	enum class Algorithm { DetK, LocalBIP, BalSep };
+
+	// Configuration of a single search
+	struct Config {
+		Algorithm Alg;
+		EdgeOrder Order;
+		// Seed of the random tie-breaks of the ordering (0 keeps the global random numbers)
+		unsigned int Seed;
+	};
+
+private:
+	vector<Config> MyConfigs;
+
+	// Decomposition of each configuration; the caches are kept from one width to the next
+	vector<unique_ptr<Decomp>> MyDecomps;
+
+	// Index of the configuration that found the last decomposition (-1 if none)
+	int MyWinner{ -1 };
+
+	// Memory limit of the component cache of each configuration in bytes (0 if unlimited)
+	size_t MyCacheLimit{ 0 };
+
+public:
+	PortfolioDecomp(const HypergraphSharedPtr &HGraph, int k);
+	virtual ~PortfolioDecomp();
+
+	// Adds a configuration to the race
+	void addConfig(const Config &C);
+
+	// Limits the memory of the component cache of each configuration added afterwards (0 if unlimited)
+	void setCacheLimit(size_t Bytes) { MyCacheLimit = Bytes; }
+
+	// Returns the number of configurations
+	size_t nbrOfConfigs() const { return MyConfigs.size(); }
+
+	// Returns a configuration
+	const Config &getConfig(size_t i) const { return MyConfigs[i]; }
+
+	// Returns the index of the configuration that found the last decomposition (-1 if none)
+	int getWinner() const { return MyWinner; }
+
+	// Constructs a hypertree decomposition of width at most MyK (if one of the configurations finds it)
+	virtual HypertreeSharedPtr buildHypertree();
+
+	// Constructs a hypertree decomposition of width at most MyK whose root covers the given vertices
+	virtual HypertreeSharedPtr buildRootedHypertree(const VertexSet &Root);
+
+	// Changes the maximum width of all configurations
+	virtual void setWidth(int k);
+
+	// Parses a configuration of the form <algorithm>:<ordering>[:<seed>] (e.g., "det:mcs:3")
+	static bool parseConfig(const string &Spec, Config &C);
+
+	// Returns the name of a configuration in the form accepted by parseConfig
+	static string getConfigName(const Config &C);
+};
+
+#endif
@@ -0,0 +1,316 @@
+#include <algorithm>
+#include <map>
+
+#include "Preprocessor.h"
+#include "FractionalEdgeCover.h"
+#include "HypergraphCore.h"
+
+Preprocessor::Preprocessor(bool Subsumed, bool Classes, bool Private) :
+	MySubsumed{ Subsumed }, MyClasses{ Classes }, MyPrivate{ Private }
+{
+}
+
+/*
+***Description***
+The method applies all enabled reductions once to Hg. Vertices occurring in exactly the same
+edges are merged into a single representative. Vertices occurring in a single edge only are
+stripped from this edge unless nothing else would remain of it. Finally, every edge whose
+vertices are contained in another edge is removed (of several equal edges the first one is kept).
+
+INPUT:	Hg: Hypergraph
+OUTPUT: return: Reduced hypergraph (nullptr if no reduction applies)
+*/
+
+HypergraphSharedPtr Preprocessor::reduceOnce(const HypergraphSharedPtr &Hg)
+{
+	const HypergraphCore &hg = *Hg->core();
+	size_t cnt_edges{ hg.nbrOfEdges() }, cnt_vertices{ hg.nbrOfVertices() };
+	size_t cnt_subsumed{ 0 }, cnt_merged{ 0 }, cnt_private{ 0 };
+	// Vertex classes; the first vertex of each class is its representative
+	vector<VertexVector> classes;
+	vector<uint> reps;
+	vector<int> class_of(cnt_vertices);
+	vector<char> stripped;
+	// Non-stripped classes of each edge
+	vector<vector<int>> edge_classes(cnt_edges);
+	vector<char> removed(cnt_edges, 0);
+	map<vector<uint>, int> types;
+	Round round;
+
+	// Vertices occurring in the same edges form a class
+	for (uint v = 0; v < cnt_vertices; v++) {
+		int c = (int)classes.size();
+		if (MyClasses) {
+			vector<uint> type(hg.vertexEdges(v).begin(), hg.vertexEdges(v).end());
+			sort(type.begin(), type.end());
+			c = types.emplace(move(type), c).first->second;
+		}
+		if (c == (int)classes.size()) {
+			classes.emplace_back();
+			reps.push_back(v);
+		}
+		classes[c].push_back(hg.vertex(v));
+		class_of[v] = c;
+	}
+	stripped.resize(classes.size(), 0);
+
+	// Strip the classes occurring in a single edge as long as some other vertex remains in the edge
+	for (uint e = 0; e < cnt_edges; e++) {
+		size_t cnt{ 0 };
+
+		for (auto v : hg.edgeVertices(e))
+			if (reps[class_of[v]] == v) {
+				edge_classes[e].push_back(class_of[v]);
+				if (MyPrivate && hg.vertexDegree(v) == 1)
+					cnt += classes[class_of[v]].size();
+			}
+
+		if (cnt > 0 && cnt < hg.edgeSize(e)) {
+			VertexVector vertices;
+			auto last = remove_if(edge_classes[e].begin(), edge_classes[e].end(), [&](int c) {
+				if (hg.vertexDegree(reps[c]) != 1)
+					return false;
+				stripped[c] = 1;
+				vertices.insert(vertices.end(), classes[c].begin(), classes[c].end());
+				return true;
+			});
+			edge_classes[e].erase(last, edge_classes[e].end());
+			cnt_private += vertices.size();
+			round.Private.emplace_back(hg.edge(e), move(vertices));
+		}
+	}
+
+	// Remove the edges contained in other edges
+	if (MySubsumed) {
+		vector<int> marks(classes.size(), -1);
+
+		for (uint e = 0; e < cnt_edges; e++) {
+			auto &cls = edge_classes[e];
+			if (cls.empty())
+				continue;
+			int rarest = cls.front();
+
+			// Each superset contains the class of the edge occurring in the fewest edges
+			for (auto c : cls) {
+				marks[c] = e;
+				if (hg.vertexDegree(reps[c]) < hg.vertexDegree(reps[rarest]))
+					rarest = c;
+			}
+
+			for (auto f : hg.vertexEdges(reps[rarest])) {
+				auto &sup = edge_classes[f];
+				if (f == e || sup.size() < cls.size() || (sup.size() == cls.size() && f > e))
+					continue;
+				size_t cnt{ 0 };
+				for (auto c : sup)
+					if (marks[c] == (int)e)
+						cnt++;
+				if (cnt == cls.size()) {
+					removed[e] = 1;
+					cnt_subsumed++;
+					break;
+				}
+			}
+		}
+	}
+
+	for (size_t c = 0; c < classes.size(); c++)
+		if (!stripped[c] && classes[c].size() > 1) {
+			cnt_merged += classes[c].size() - 1;
+			round.Classes[classes[c].front()] = VertexVector(classes[c].begin() + 1, classes[c].end());
+		}
+
+	if (cnt_subsumed == 0 && cnt_merged == 0 && cnt_private == 0)
+		return nullptr;
+
+	// Build the reduced hypergraph; reduced edges keep the ID and the name of their source
+	HypergraphSharedPtr reduced = make_shared<Hypergraph>();
+	HyperedgeVector edges;
+	for (uint e = 0; e < cnt_edges; e++)
+		if (!removed[e]) {
+			HyperedgeSharedPtr he = make_shared<Hyperedge>(hg.edge(e)->getId(), hg.edge(e)->getName());
+			for (auto c : edge_classes[e])
+				he->add(classes[c].front());
+			round.Sources[he] = hg.edge(e);
+			edges.push_back(he);
+		}
+	reduced->build(edges);
+
+	round.Hg = Hg;
+	MyRounds.push_back(move(round));
+	MyCntSubsumed += cnt_subsumed;
+	MyCntMerged += cnt_merged;
+	MyCntPrivate += cnt_private;
+
+	return reduced;
+}
+
+HypergraphSharedPtr Preprocessor::reduce(const HypergraphSharedPtr &Hg)
+{
+	HypergraphSharedPtr hg = Hg, reduced;
+
+	// Each reduction may enable further ones (e.g., stripping a vertex may make an edge subsumed)
+	while ((reduced = reduceOnce(hg)) != nullptr)
+		hg = reduced;
+
+	return hg;
+}
+
+void Preprocessor::liftVertex(const Round &R, const VertexSharedPtr &V, VertexSet &Vertices) const
+{
+	Vertices.insert(V);
+
+	auto it = R.Classes.find(V);
+	if (it != R.Classes.end())
+		Vertices.insert(it->second.begin(), it->second.end());
+}
+
+HyperedgeSharedPtr Preprocessor::liftEdge(const Round &R, const HyperedgeSharedPtr &He,
+	unordered_map<HyperedgeSharedPtr, HyperedgeSharedPtr, NamedEntityHash> &Lifted) const
+{
+	auto it = R.Sources.find(He);
+	if (it != R.Sources.end())
+		return it->second;
+
+	HyperedgeSharedPtr &he = Lifted[He];
+	if (he == nullptr) {
+		VertexSet vertices;
+		for (auto &v : He->allVertices())
+			liftVertex(R, v, vertices);
+		he = make_shared<Hyperedge>(He->getId(), He->getName(), vertices);
+	}
+
+	return he;
+}
+
+HypertreeSharedPtr Preprocessor::liftNode(const Round &R, const HypertreeSharedPtr &Node,
+	unordered_map<HyperedgeSharedPtr, HyperedgeSharedPtr, NamedEntityHash> &Lifted) const
+{
+	HypertreeSharedPtr node = make_shared<Hypertree>(R.Hg);
+	VertexSet chi;
+
+	for (auto &v : Node->allChi())
+		liftVertex(R, v, chi);
+	for (auto &v : chi)
+		node->insChi(v);
+	for (auto &he : Node->allLambda())
+		node->insLambda(liftEdge(R, he, Lifted));
+
+	auto &fec = Node->getFec();
+	if (fec != nullptr) {
+		VertexSet bag;
+		HyperedgeVector edges;
+		for (auto &v : fec->getBag())
+			liftVertex(R, v, bag);
+		for (auto &he : fec->getEdges())
+			edges.push_back(liftEdge(R, he, Lifted));
+		auto lifted = make_unique<FractionalEdgeCover>(bag, edges, fec->getWeights());
+		node->setFec(lifted);
+	}
+
+	for (auto &child : Node->allChildren())
+		node->insChild(liftNode(R, child, Lifted));
+
+	return node;
+}
+
+/*
+***Description***
+The method lifts a hypertree of the hypergraph obtained by a single round of reductions to a
+hypertree of the input of this round. Merged vertices are put wherever their representative
+occurs and reduced edges are replaced by their sources. The vertices stripped from an edge are
+inserted into the topmost node covering the rest of the edge and containing the edge in its
+lambda-set; if there is no such node, a new leaf covering the whole edge is appended to the
+first node covering the rest of the edge. In both cases the hypertree conditions remain satisfied.
+
+INPUT:	R: Round of reductions
+		HTree: Hypertree of the reduced hypergraph
+OUTPUT: return: Hypertree of the input hypergraph
+*/
+
+HypertreeSharedPtr Preprocessor::liftOnce(const Round &R, const HypertreeSharedPtr &HTree) const
+{
+	unordered_map<HyperedgeSharedPtr, HyperedgeSharedPtr, NamedEntityHash> lifted;
+	HypertreeSharedPtr root = liftNode(R, HTree, lifted);
+	vector<HypertreeSharedPtr> nodes{ root };
+
+	// Collect the nodes in breadth-first order
+	for (size_t i = 0; i < nodes.size(); i++)
+		for (auto &child : nodes[i]->allChildren())
+			nodes.push_back(child);
+
+	for (auto &entry : R.Private) {
+		const HyperedgeSharedPtr &he = entry.first;
+		const VertexVector &vertices = entry.second;
+		HypertreeSharedPtr cover{ nullptr }, owner{ nullptr };
+
+		for (auto it = nodes.begin(); it != nodes.end() && owner == nullptr; it++) {
+			auto &chi = (*it)->getChi();
+			bool covered{ true };
+			for (auto &v : he->allVertices())
+				if (chi.find(v) == chi.end() && find(vertices.begin(), vertices.end(), v) == vertices.end()) {
+					covered = false;
+					break;
+				}
+			if (covered) {
+				if ((*it)->getLambda().find(he) != (*it)->getLambda().end())
+					owner = *it;
+				else if (cover == nullptr)
+					cover = *it;
+			}
+		}
+
+		if (owner != nullptr) {
+			for (auto &v : vertices)
+				owner->insChi(v);
+
+			// The stripped vertices are only covered by the edge itself
+			auto &fec = owner->getFec();
+			if (fec != nullptr) {
+				VertexSet bag(fec->getBag());
+				HyperedgeVector edges(fec->getEdges());
+				vector<double> weights(fec->getWeights());
+				auto pos = find(edges.begin(), edges.end(), he);
+				if (pos == edges.end()) {
+					edges.push_back(he);
+					weights.push_back(1.0);
+				}
+				else
+					weights[pos - edges.begin()] = max(weights[pos - edges.begin()], 1.0);
+				bag.insert(vertices.begin(), vertices.end());
+				auto extended = make_unique<FractionalEdgeCover>(bag, edges, weights);
+				owner->setFec(extended);
+			}
+		}
+		else {
+			HypertreeSharedPtr leaf = make_shared<Hypertree>(R.Hg);
+			for (auto &v : he->allVertices())
+				leaf->insChi(v);
+			leaf->insLambda(he);
+			if (root->getFec() != nullptr) {
+				auto fec = make_unique<FractionalEdgeCover>(leaf->getChi(), HyperedgeVector{ he }, vector<double>{ 1.0 });
+				leaf->setFec(fec);
+			}
+			(cover != nullptr ? cover : root)->insChild(leaf);
+			nodes.push_back(leaf);
+		}
+	}
+
+	return root;
+}
+
+HypertreeSharedPtr Preprocessor::lift(const HypertreeSharedPtr &HTree) const
+{
+	HypertreeSharedPtr htree = HTree;
+
+	for (auto it = MyRounds.rbegin(); it != MyRounds.rend(); it++)
+		htree = liftOnce(*it, htree);
+
+	return htree;
+}
+
+void Preprocessor::writeStats(ostream &out) const
+{
+	out << "Removed edges: " << MyCntSubsumed << ", merged vertices: " << MyCntMerged;
+	out << ", stripped vertices: " << MyCntPrivate << " (" << MyRounds.size() << " rounds)" << endl;
+}
@@ -0,0 +1,88 @@
+#pragma once
+// Reduces a hypergraph before it is decomposed (removes subsumed edges, merges vertices
+// occurring in the same edges and strips vertices occurring in a single edge only) and
+// lifts a hypertree of the reduced hypergraph back to the original hypergraph.
+//
+//////////////////////////////////////////////////////////////////////
+
+#if !defined(CLS_PREPROCESSOR)
+#define CLS_PREPROCESSOR
+
+#include <iostream>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Globals.h"
+#include "Hyperedge.h"
+#include "Hypergraph.h"
+#include "Hypertree.h"
+#include "Vertex.h"
+
+class Preprocessor
+{
+private:
+	// Reduction of a hypergraph into a smaller one
+	struct Round {
+		// Hypergraph before the reduction
+		HypergraphSharedPtr Hg;
+
+		// Vertices merged into a representative (the representative itself is not stored)
+		unordered_map<VertexSharedPtr, VertexVector, NamedEntityHash> Classes;
+
+		// Edges of the reduced hypergraph mapped onto the edges they were built from
+		unordered_map<HyperedgeSharedPtr, HyperedgeSharedPtr, NamedEntityHash> Sources;
+
+		// Edges together with the vertices stripped from them because they occur in no other edge
+		vector<pair<HyperedgeSharedPtr, VertexVector>> Private;
+	};
+
+	// Enabled reductions
+	bool MySubsumed;
+	bool MyClasses;
+	bool MyPrivate;
+
+	// Reductions applied to the input, in the order of their application
+	vector<Round> MyRounds;
+
+	// Number of removed edges, merged vertices, and stripped vertices
+	size_t MyCntSubsumed{ 0 };
+	size_t MyCntMerged{ 0 };
+	size_t MyCntPrivate{ 0 };
+
+	// Applies all enabled reductions once; returns nullptr if the hypergraph cannot be reduced
+	HypergraphSharedPtr reduceOnce(const HypergraphSharedPtr &Hg);
+
+	// Lifts a hypertree over the result of a round to a hypertree over its input
+	HypertreeSharedPtr liftOnce(const Round &R, const HypertreeSharedPtr &HTree) const;
+
+	// Copies a hypertree node and its subtree replacing all reduced vertices and edges
+	HypertreeSharedPtr liftNode(const Round &R, const HypertreeSharedPtr &Node,
+		unordered_map<HyperedgeSharedPtr, HyperedgeSharedPtr, NamedEntityHash> &Lifted) const;
+
+	// Returns the edge a reduced edge was built from; edges not stemming from the reduced
+	// hypergraph (e.g., subedges) are copied with all merged vertices
+	HyperedgeSharedPtr liftEdge(const Round &R, const HyperedgeSharedPtr &He,
+		unordered_map<HyperedgeSharedPtr, HyperedgeSharedPtr, NamedEntityHash> &Lifted) const;
+
+	// Inserts a vertex together with all vertices merged into it
+	void liftVertex(const Round &R, const VertexSharedPtr &V, VertexSet &Vertices) const;
+
+public:
+	// Creates a preprocessor applying the selected reductions
+	Preprocessor(bool Subsumed = true, bool Classes = true, bool Private = true);
+
+	// Reduces the hypergraph until no reduction applies anymore; the returned hypergraph
+	// shares the remaining vertices with the input
+	HypergraphSharedPtr reduce(const HypergraphSharedPtr &Hg);
+
+	// Transforms a hypertree of the reduced hypergraph into a hypertree of the input
+	// hypergraph of the same width
+	HypertreeSharedPtr lift(const HypertreeSharedPtr &HTree) const;
+
+	// Writes the number of removed edges and vertices
+	void writeStats(ostream &out) const;
+};
+
+#endif
@@ -1,53 +1,97 @@
-// Models the algorithm rank-fhdecomp using bounded rank.
-//
-//////////////////////////////////////////////////////////////////////
-
-#if !defined(CLS_RankFHDecomp)
-#define CLS_RankFHDecomp
-
-#pragma once
-#include "Globals.h"
-#include "FecCalculator.h"
-#include "Hypertree.h"
-#include "DecompComponent.h"
-#include "DetKDecomp.h"
-#include "VertexSeparator.h"
-
-class RankFHDecomp
-{
-private:
-	HypergraphSharedPtr MyHg;
-	double MyK;
-	int MyRank;
-
-	FecCalculator MyFecCalculator;
-
-	mutable unordered_map<VertexSeparatorSharedPtr, CompCache> MyTriedSeps;
-
-	CompCache &getSepParts(VertexSeparatorSharedPtr & sep) const;
-
-	size_t separate(VertexSeparatorSharedPtr bag, const HyperedgeVector &edges, vector<DecompComponent> &partitions) const;
-
-	virtual HypertreeSharedPtr decomp(const HyperedgeVector &HEdges, const VertexSet &Connector = VertexSet(), int RecLevel = 0) const;
-
-	virtual HypertreeSharedPtr decomp(const DecompComponent &comp, int recLevel) const {
-		return decomp(comp.component(), comp.connector(), recLevel);
-	}
-
-	HypertreeSharedPtr getCutNode(int label, const DecompComponent & comp, const VertexSet & ChiConnect) const;
-
-	void expandHTree(HypertreeSharedPtr &HTree) const;
-
-	HypertreeSharedPtr getHTNode(const HyperedgeVector &lambda, const VertexSet &ChiConnect, const list<HypertreeSharedPtr> &Subtrees = list<HypertreeSharedPtr>()) const;
-
-
-public:
-	RankFHDecomp(const HypergraphSharedPtr &HGraph, double k);
-	~RankFHDecomp();
-
-	// Constructs a hypertree decomposition of width at most MyK (if it exists)
-	HypertreeSharedPtr buildHypertree();
-};
-
-#endif
-
+// Models the algorithm rank-fhdecomp using bounded rank.
+//
+//////////////////////////////////////////////////////////////////////
+
+#if !defined(CLS_RankFHDecomp)
+#define CLS_RankFHDecomp
+
+#pragma once
+#include "Globals.h"
+#include "FecCalculator.h"
+#include "Hypertree.h"
+#include "DecompComponent.h"
+#include "DetKDecomp.h"
+#include "VertexSeparator.h"
+
+class RankFHDecomp
+{
+private:
+	HypergraphSharedPtr MyHg;
+	double MyK;
+	int MyRank;
+
+	FecCalculator MyFecCalculator;
+
+	// Components of the tried bags known to be decomposable or undecomposable
+	mutable SeparatorCache<VertexSeparatorSharedPtr> MyTriedSeps;
+
+	// Thread pool used to decompose sibling components concurrently (nullptr if the search is sequential)
+	unique_ptr<WorkStealingPool> MyPool;
+
+	// Sibling components of bags up to this recursion level are decomposed concurrently
+	int MyCompDepth{ 0 };
+
+	// Budget of the search (nullptr if the search is unlimited)
+	SearchBudgetSharedPtr MyBudget;
+
+	// Heuristic for ordering the hyperedges before the search
+	EdgeOrder MyOrder{ EdgeOrder::MCS };
+
+	// Charges the budget for a bag and counts it as enumerated; returns false if the search has
+	// to stop (the bag is then neither charged nor counted)
+	bool trySeparator() const {
+		if (MyBudget != nullptr && !MyBudget->trySeparator())
+			return false;
+		SearchStats::count(SearchStats::Counter::SepsEnumerated);
+		return true;
+	}
+
+	// Checks whether the search was cancelled or stopped by the budget
+	bool interrupted() const { return TaskGroup::cancelled() || (MyBudget != nullptr && MyBudget->exhausted()); }
+
+	CompCacheSharedPtr getSepParts(VertexSeparatorSharedPtr & sep) const;
+
+	size_t separate(VertexSeparatorSharedPtr bag, const HyperedgeVector &edges, vector<DecompComponent> &partitions) const;
+
+	// Decomposes a component and records the result in the cache of its bag
+	HypertreeSharedPtr decompPartition(const DecompComponent &comp, const CompFingerprint &fingerprint, CompCache &reused, int RecLevel) const;
+
+	virtual HypertreeSharedPtr decomp(const HyperedgeVector &HEdges, const VertexSet &Connector = VertexSet(), int RecLevel = 0) const;
+
+	virtual HypertreeSharedPtr decomp(const DecompComponent &comp, int recLevel) const {
+		return decomp(comp.component(), comp.connector(), recLevel);
+	}
+
+	HypertreeSharedPtr getCutNode(int label, const DecompComponent & comp, const VertexSet & ChiConnect) const;
+
+	void expandHTree(HypertreeSharedPtr &HTree) const;
+
+	HypertreeSharedPtr getHTNode(const HyperedgeVector &lambda, const VertexSet &ChiConnect, const list<HypertreeSharedPtr> &Subtrees = list<HypertreeSharedPtr>()) const;
+
+
+public:
+	RankFHDecomp(const HypergraphSharedPtr &HGraph, double k);
+	~RankFHDecomp();
+
+	// Constructs a hypertree decomposition of width at most MyK (if it exists)
+	HypertreeSharedPtr buildHypertree();
+
+	// Decomposes sibling components of the top CompDepth recursion levels concurrently using the given number of threads
+	void setParallel(size_t NbrOfThreads, int CompDepth = 2);
+
+	// Limits the search by a budget (nullptr for an unlimited search)
+	void setBudget(const SearchBudgetSharedPtr &budget) { MyBudget = budget; }
+
+	// Selects the heuristic for ordering the hyperedges
+	void setEdgeOrder(EdgeOrder Order) { MyOrder = Order; }
+
+	// Returns the number of bags found resp. not found in the separator cache
+	size_t getSepCacheHits() const { return MyTriedSeps.hits(); }
+	size_t getSepCacheMisses() const { return MyTriedSeps.misses(); }
+
+	// Limits the estimated memory of the bag cache (0 if unlimited)
+	void setCacheLimit(size_t Bytes) { MyTriedSeps.setLimit(Bytes); }
+};
+
+#endif
+
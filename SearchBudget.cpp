@@ -0,0 +1,86 @@
+#include <cstdio>
+#if !defined(_WIN32)
+#include <unistd.h>
+#endif
+
+#include "SearchBudget.h"
+
+// The memory is only checked every MEM_CHECK_INTERVAL separators
+#define MEM_CHECK_INTERVAL 1024
+
+SearchBudget::SearchBudget(double TimeLimit, size_t SepLimit, size_t MemLimit, const shared_ptr<SearchBudget> &Parent) :
+	MyStart{ chrono::steady_clock::now() }, MyTimeLimit{ TimeLimit }, MySepLimit{ SepLimit }, MyMemLimit{ MemLimit }, MyParent{ Parent }
+{
+}
+
+void SearchBudget::exhaust(Limit limit)
+{
+	Limit none = Limit::None;
+	MyExhausted.compare_exchange_strong(none, limit);
+}
+
+bool SearchBudget::trySeparator()
+{
+	if (exhausted())
+		return false;
+
+	size_t cnt = ++MySeparators;
+
+	if (MySepLimit > 0 && cnt > MySepLimit)
+		exhaust(Limit::Separators);
+	else if (MyTimeLimit > 0 && elapsed() > MyTimeLimit)
+		exhaust(Limit::Time);
+	else if (MyMemLimit > 0 && cnt % MEM_CHECK_INTERVAL == 0 && memoryUsage() > MyMemLimit)
+		exhaust(Limit::Memory);
+
+	// A refused separator is not tried, so it is not counted (neither here nor by the parent)
+	if (exhausted() || (MyParent != nullptr && !MyParent->trySeparator())) {
+		--MySeparators;
+		return false;
+	}
+
+	return true;
+}
+
+double SearchBudget::elapsed() const
+{
+	return chrono::duration<double>(chrono::steady_clock::now() - MyStart).count();
+}
+
+size_t SearchBudget::memoryUsage()
+{
+	size_t mem = 0;
+
+#if defined(__linux__)
+	// The second field of statm is the number of resident pages
+	FILE *statm = fopen("/proc/self/statm", "r");
+	unsigned long size, resident;
+
+	if (statm != nullptr) {
+		if (fscanf(statm, "%lu %lu", &size, &resident) == 2)
+			mem = (size_t)resident * (size_t)sysconf(_SC_PAGESIZE) / (1024 * 1024);
+		fclose(statm);
+	}
+#endif
+
+	return mem;
+}
+
+void SearchBudget::writeStats(ostream &out) const
+{
+	switch (exhaustedLimit()) {
+	case Limit::Time:
+		out << "Time limit of " << MyTimeLimit << " sec exceeded";
+		break;
+	case Limit::Separators:
+		out << "Separator limit of " << MySepLimit << " exceeded";
+		break;
+	case Limit::Memory:
+		out << "Memory limit of " << MyMemLimit << " MB exceeded";
+		break;
+	default:
+		out << "Search statistics";
+	}
+
+	out << " (" << separators() << " separators tried in " << elapsed() << " sec, " << memoryUsage() << " MB)." << endl;
+}
@@ -0,0 +1,73 @@
+#pragma once
+// Models a budget of a search for a decomposition (wall-clock time, number of separators
+// and memory). The search charges the budget for every separator it tries and unwinds
+// as soon as the budget is exhausted.
+//
+//////////////////////////////////////////////////////////////////////
+
+#if !defined(CLS_SEARCHBUDGET)
+#define CLS_SEARCHBUDGET
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+
+#include "Globals.h"
+
+class SearchBudget
+{
+public:
+	// Limit that stopped the search
+	enum class Limit { None, Time, Separators, Memory };
+
+private:
+	chrono::steady_clock::time_point MyStart;
+
+	// Limits (0 if unlimited): wall-clock time in seconds, number of separators, memory in MB
+	double MyTimeLimit;
+	size_t MySepLimit;
+	size_t MyMemLimit;
+
+	// Number of separators tried so far
+	atomic<size_t> MySeparators{ 0 };
+
+	// Limit that was reached first (Limit::None while the budget is not exhausted)
+	atomic<Limit> MyExhausted{ Limit::None };
+
+	// Budget charged for every separator as well (nullptr if there is none)
+	shared_ptr<SearchBudget> MyParent;
+
+	// Sets the exhausted limit unless another limit was reached before
+	void exhaust(Limit limit);
+
+public:
+	// Creates a budget; the wall-clock time is measured from the construction. A budget with a
+	// parent is exhausted as soon as the parent is exhausted.
+	SearchBudget(double TimeLimit = 0, size_t SepLimit = 0, size_t MemLimit = 0, const shared_ptr<SearchBudget> &Parent = nullptr);
+
+	// Charges a separator; returns false (and does not count the separator) if the budget is exhausted
+	bool trySeparator();
+
+	// Checks whether the budget is exhausted
+	bool exhausted() const { return MyExhausted != Limit::None || (MyParent != nullptr && MyParent->exhausted()); }
+
+	// Returns the limit that was reached first (the limit of the parent if the parent is exhausted)
+	Limit exhaustedLimit() const { return MyParent != nullptr && MyParent->exhausted() ? MyParent->exhaustedLimit() : MyExhausted.load(); }
+
+	// Returns the number of separators tried so far
+	size_t separators() const { return MySeparators; }
+
+	// Returns the seconds elapsed since the construction
+	double elapsed() const;
+
+	// Returns the resident memory of the process in MB (0 if unknown)
+	static size_t memoryUsage();
+
+	// Writes the statistics of the search
+	void writeStats(ostream &out) const;
+};
+
+using SearchBudgetSharedPtr = shared_ptr<SearchBudget>;
+
+#endif
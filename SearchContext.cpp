@@ -0,0 +1,37 @@
+#include <algorithm>
+
+#include "SearchContext.h"
+
+void SearchContext::LabelArray::reset(int value)
+{
+	MyDefault = value;
+	MyOtherLabels.clear();
+
+	// Invalidate all labels by starting a new epoch; on overflow clear the stamps
+	if (++MyEpoch == 0) {
+		fill(MyStamps.begin(), MyStamps.end(), 0);
+		MyEpoch = 1;
+	}
+}
+
+SearchContext::SearchContext(const HypergraphCoreSharedPtr &core) : MyCore{ core }
+{
+	MyVertexLabels.resize(core->nbrOfVertices());
+	MyEdgeLabels.resize(core->nbrOfEdges());
+}
+
+void SearchContext::setAllLabels(const HyperedgeSharedPtr &he, int label)
+{
+	int idx = index(he);
+
+	if (idx >= 0) {
+		MyEdgeLabels.set(idx, label);
+		for (auto v : MyCore->edgeVertices(idx))
+			MyVertexLabels.set(v, label);
+	}
+	else {
+		MyEdgeLabels.setOther(he->getId(), label);
+		for (auto &v : he->allVertices())
+			setLabel(v, label);
+	}
+}
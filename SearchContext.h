@@ -0,0 +1,106 @@
+#pragma once
+// Models the labels of vertices and edges used by a single search.
+//
+//////////////////////////////////////////////////////////////////////
+
+#if !defined(CLS_SEARCHCONTEXT)
+#define CLS_SEARCHCONTEXT
+
+#include <vector>
+#include <unordered_map>
+
+#include "Globals.h"
+#include "Hyperedge.h"
+#include "Vertex.h"
+#include "HypergraphCore.h"
+
+class SearchContext
+{
+private:
+	// Labels indexed by dense IDs; a label is only valid if it carries the current epoch
+	class LabelArray
+	{
+	private:
+		vector<int> MyLabels;
+		vector<uint> MyStamps;
+		uint MyEpoch{ 1 };
+		int MyDefault{ 0 };
+
+		// Labels of entities outside the core (e.g., subedges) indexed by their ID
+		unordered_map<uint, int> MyOtherLabels;
+
+	public:
+		void resize(size_t size) { MyLabels.resize(size); MyStamps.resize(size, 0); }
+
+		// Sets all labels to value in constant time
+		void reset(int value);
+
+		int get(uint idx) const { return MyStamps[idx] == MyEpoch ? MyLabels[idx] : MyDefault; }
+		void set(uint idx, int label) { MyStamps[idx] = MyEpoch; MyLabels[idx] = label; }
+
+		int getOther(uint id) const {
+			auto it = MyOtherLabels.find(id);
+			return it != MyOtherLabels.end() ? it->second : MyDefault;
+		}
+		void setOther(uint id, int label) { MyOtherLabels[id] = label; }
+	};
+
+	HypergraphCoreSharedPtr MyCore;
+	LabelArray MyVertexLabels;
+	LabelArray MyEdgeLabels;
+
+	int index(const VertexSharedPtr &v) const {
+		int idx = MyCore->vertexIndex(v);
+		return (idx >= 0 && MyCore->vertex(idx) == v) ? idx : -1;
+	}
+
+	int index(const HyperedgeSharedPtr &he) const {
+		int idx = MyCore->edgeIndex(he);
+		return (idx >= 0 && MyCore->edge(idx) == he) ? idx : -1;
+	}
+
+public:
+	SearchContext(const HypergraphCoreSharedPtr &core);
+
+	// Returns the hypergraph the labels are indexed against
+	const HypergraphCoreSharedPtr &core() const { return MyCore; }
+
+	// Sets the labels of all vertices resp. edges to value (constant time)
+	void resetVertexLabels(int value = 0) { MyVertexLabels.reset(value); }
+	void resetEdgeLabels(int value = 0) { MyEdgeLabels.reset(value); }
+	void resetLabels(int value = 0) { resetVertexLabels(value); resetEdgeLabels(value); }
+
+	// Access labels by the dense index in the core
+	int vertexLabel(uint idx) const { return MyVertexLabels.get(idx); }
+	void setVertexLabel(uint idx, int label) { MyVertexLabels.set(idx, label); }
+	int edgeLabel(uint idx) const { return MyEdgeLabels.get(idx); }
+	void setEdgeLabel(uint idx, int label) { MyEdgeLabels.set(idx, label); }
+
+	// Access labels by entity
+	int label(const VertexSharedPtr &v) const {
+		int idx = index(v);
+		return idx >= 0 ? MyVertexLabels.get(idx) : MyVertexLabels.getOther(v->getId());
+	}
+
+	void setLabel(const VertexSharedPtr &v, int label) {
+		int idx = index(v);
+		idx >= 0 ? MyVertexLabels.set(idx, label) : MyVertexLabels.setOther(v->getId(), label);
+	}
+
+	int label(const HyperedgeSharedPtr &he) const {
+		int idx = index(he);
+		return idx >= 0 ? MyEdgeLabels.get(idx) : MyEdgeLabels.getOther(he->getId());
+	}
+
+	void setLabel(const HyperedgeSharedPtr &he, int label) {
+		int idx = index(he);
+		idx >= 0 ? MyEdgeLabels.set(idx, label) : MyEdgeLabels.setOther(he->getId(), label);
+	}
+
+	void incLabel(const HyperedgeSharedPtr &he) { setLabel(he, label(he) + 1); }
+
+	// Labels an edge and all its vertices
+	void setAllLabels(const HyperedgeSharedPtr &he, int label);
+};
+
+#endif
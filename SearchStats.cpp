@@ -0,0 +1,84 @@
+#include <cstdlib>
+#include <fstream>
+
+#include "SearchStats.h"
+
+bool SearchStats::sEnabled{ false };
+string SearchStats::sFile;
+atomic<size_t> SearchStats::sCounters[(int)Counter::Count];
+atomic<long long> SearchStats::sTimes[(int)Timer::Count];
+atomic<size_t> SearchStats::sCacheBytes{ 0 };
+atomic<size_t> SearchStats::sPeakCacheBytes{ 0 };
+vector<pair<size_t, size_t>> SearchStats::sComponents;
+mutex SearchStats::sLock;
+
+void SearchStats::enable(const string &File)
+{
+	if (!sEnabled)
+		atexit(writeAtExit);
+
+	sEnabled = true;
+	sFile = File;
+}
+
+void SearchStats::countComponent(int RecLevel, bool Decomposed)
+{
+	if (!sEnabled || RecLevel < 0)
+		return;
+
+	lock_guard<mutex> guard(sLock);
+	if (sComponents.size() <= (size_t)RecLevel)
+		sComponents.resize(RecLevel + 1);
+	if (Decomposed)
+		sComponents[RecLevel].first++;
+	else
+		sComponents[RecLevel].second++;
+}
+
+void SearchStats::writeAtExit()
+{
+	if (sFile == "-") {
+		writeJson(cout);
+		return;
+	}
+
+	ofstream out(sFile);
+	if (!out)
+		writeErrorMsg("Cannot write statistics to \"" + sFile + "\".", "SearchStats::writeAtExit", false);
+	else
+		writeJson(out);
+}
+
+void SearchStats::writeJson(ostream &out)
+{
+	auto seconds = [](Timer T) { return sTimes[(int)T] / 1e9; };
+	auto counter = [](Counter C) { return sCounters[(int)C].load(); };
+
+	out << "{" << endl;
+	out << "  \"separators\": { \"enumerated\": " << counter(Counter::SepsEnumerated);
+	out << ", \"pruned\": " << counter(Counter::SepsPruned) << " }," << endl;
+	out << "  \"separatorCache\": { \"hits\": " << counter(Counter::SepCacheHits);
+	out << ", \"misses\": " << counter(Counter::SepCacheMisses) << " }," << endl;
+	out << "  \"cache\": { \"hits\": " << counter(Counter::CacheHits);
+	out << ", \"misses\": " << counter(Counter::CacheMisses) << ", \"evictions\": " << counter(Counter::CacheEvictions);
+	out << ", \"bytes\": " << sCacheBytes << ", \"peakBytes\": " << sPeakCacheBytes << " }," << endl;
+	out << "  \"componentTable\": { \"recorded\": " << counter(Counter::TableRecorded);
+	out << ", \"hits\": " << counter(Counter::TableHits) << " }," << endl;
+	out << "  \"nogoods\": { \"learned\": " << counter(Counter::NogoodsLearned);
+	out << ", \"hits\": " << counter(Counter::NogoodHits) << " }," << endl;
+
+	out << "  \"components\": [";
+	{
+		lock_guard<mutex> guard(sLock);
+		for (size_t i = 0; i < sComponents.size(); i++) {
+			out << (i > 0 ? "," : "") << endl << "    { \"depth\": " << i;
+			out << ", \"decomposed\": " << sComponents[i].first << ", \"failed\": " << sComponents[i].second << " }";
+		}
+	}
+	out << (sComponents.empty() ? "" : "\n  ") << "]," << endl;
+
+	out << "  \"lp\": { \"calls\": " << counter(Counter::LpCalls) << ", \"seconds\": " << seconds(Timer::Lp) << " }," << endl;
+	out << "  \"seconds\": { \"separate\": " << seconds(Timer::Separate);
+	out << ", \"coverNodes\": " << seconds(Timer::CoverNodes) << " }" << endl;
+	out << "}" << endl;
+}
@@ -0,0 +1,105 @@
+#pragma once
+// Collects statistics of all searches of the process (separators, cache lookups and memory, nogoods,
+// components per recursion level, LP calls, and the time spent in frequently called methods) and writes
+// them as JSON. The statistics are only collected after they have been enabled.
+//
+//////////////////////////////////////////////////////////////////////
+
+#if !defined(CLS_SEARCHSTATS)
+#define CLS_SEARCHSTATS
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "Globals.h"
+
+class SearchStats
+{
+public:
+	// Counted events
+	enum class Counter { SepsEnumerated, SepsPruned, SepCacheHits, SepCacheMisses, CacheHits, CacheMisses, CacheEvictions, TableRecorded, TableHits, NogoodsLearned, NogoodHits, LpCalls, Count };
+
+	// Timed methods
+	enum class Timer { Separate, CoverNodes, Lp, Count };
+
+	// Adds the time from its construction to its destruction to a timer
+	class ScopedTimer
+	{
+	private:
+		Timer MyTimer;
+		bool MyActive;
+		chrono::steady_clock::time_point MyStart;
+
+	public:
+		ScopedTimer(Timer T) : MyTimer{ T }, MyActive{ sEnabled } {
+			if (MyActive)
+				MyStart = chrono::steady_clock::now();
+		}
+		~ScopedTimer() {
+			if (MyActive)
+				addTime(MyTimer, chrono::steady_clock::now() - MyStart);
+		}
+	};
+
+private:
+	static bool sEnabled;
+
+	// File the statistics are written to at exit ("-" for the standard output)
+	static string sFile;
+
+	static atomic<size_t> sCounters[(int)Counter::Count];
+
+	// Accumulated times in nanoseconds
+	static atomic<long long> sTimes[(int)Timer::Count];
+
+	// Estimated memory of all component caches and its maximum in bytes
+	static atomic<size_t> sCacheBytes;
+	static atomic<size_t> sPeakCacheBytes;
+
+	// Number of decomposed and failed components per recursion level
+	static vector<pair<size_t, size_t>> sComponents;
+	static mutex sLock;
+
+	static void addTime(Timer T, chrono::steady_clock::duration Time) {
+		sTimes[(int)T] += chrono::duration_cast<chrono::nanoseconds>(Time).count();
+	}
+
+	static void writeAtExit();
+
+public:
+	// Enables the statistics and writes them to the given file at exit ("-" for the standard output)
+	static void enable(const string &File);
+
+	// Checks whether the statistics are collected
+	static bool enabled() { return sEnabled; }
+
+	// Counts an event
+	static void count(Counter C, size_t N = 1) {
+		if (sEnabled)
+			sCounters[(int)C] += N;
+	}
+
+	// Adds resp. removes memory of a component cache
+	static void addCacheBytes(size_t Bytes) {
+		if (!sEnabled)
+			return;
+		size_t bytes = sCacheBytes += Bytes, peak = sPeakCacheBytes;
+		while (bytes > peak && !sPeakCacheBytes.compare_exchange_weak(peak, bytes));
+	}
+	static void releaseCacheBytes(size_t Bytes) {
+		if (sEnabled)
+			sCacheBytes -= Bytes;
+	}
+
+	// Counts a component that was decomposed or proven undecomposable at a recursion level
+	static void countComponent(int RecLevel, bool Decomposed);
+
+	// Writes the statistics as a JSON object
+	static void writeJson(ostream &out);
+};
+
+#endif
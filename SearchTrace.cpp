@@ -0,0 +1,198 @@
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <unordered_map>
+
+#include "SearchTrace.h"
+#include "Hyperedge.h"
+#include "Vertex.h"
+
+// Magic number at the begin of each trace
+static const char cMagic[8] = { 'D', 'K', 'T', 'R', 'A', 'C', 'E', '1' };
+
+bool SearchTrace::sEnabled{ false };
+FILE *SearchTrace::sFile{ nullptr };
+mutex SearchTrace::sLock;
+chrono::steady_clock::time_point SearchTrace::sStart;
+
+// Small ID of the calling thread (numbered in the order of their first event)
+static uint16_t threadId()
+{
+	static atomic<uint16_t> next_id{ 0 };
+	thread_local uint16_t id{ next_id++ };
+	return id;
+}
+
+void SearchTrace::enable(const string &File, const HypergraphSharedPtr &Hg)
+{
+	if (sEnabled)
+		return;
+
+	sFile = fopen(File.c_str(), "wb");
+	if (sFile == nullptr) {
+		writeErrorMsg("Cannot write trace to \"" + File + "\".", "SearchTrace::enable", false);
+		return;
+	}
+
+	fwrite(cMagic, sizeof(cMagic), 1, sFile);
+	sStart = chrono::steady_clock::now();
+	sEnabled = true;
+	atexit(close);
+
+	for (auto &he : Hg->allEdges()) {
+		string name = he->getName();
+		write(Kind::EdgeName, 0, he->getId(), name.data(), (uint32_t)name.size());
+	}
+	for (auto &v : Hg->allVertices()) {
+		string name = v->getName();
+		write(Kind::VertexName, 0, v->getId(), name.data(), (uint32_t)name.size());
+	}
+}
+
+void SearchTrace::close()
+{
+	lock_guard<mutex> guard(sLock);
+	sEnabled = false;
+	if (sFile != nullptr)
+		fclose(sFile);
+	sFile = nullptr;
+}
+
+/*
+***Description***
+The method appends an event to the trace. Events of all threads go into the same file, so the
+record and its payload are written under a lock.
+
+INPUT:	Type: Kind of the event
+		Level: Recursion level
+		Arg: Argument of the event (see Kind)
+		Payload: Count 32-bit IDs for separators and bags, Count characters for names
+		Count: Length of the payload
+*/
+
+void SearchTrace::write(Kind Type, int Level, uint32_t Arg, const void *Payload, uint32_t Count)
+{
+	Event e;
+
+	memset(&e, 0, sizeof(e));
+	e.Time = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - sStart).count();
+	e.Arg = Arg;
+	e.Count = Count;
+	e.Thread = threadId();
+	e.Level = (uint16_t)(Level < 0 ? 0 : Level);
+	e.Type = Type;
+
+	size_t width = (Type == Kind::EdgeName || Type == Kind::VertexName) ? 1 : sizeof(uint32_t);
+
+	lock_guard<mutex> guard(sLock);
+	if (sFile == nullptr)
+		return;
+	fwrite(&e, sizeof(e), 1, sFile);
+	if (Count > 0)
+		fwrite(Payload, width, Count, sFile);
+}
+
+// Escapes a string for JSON
+static string escapeJson(const string &s)
+{
+	string res;
+
+	for (char c : s)
+		if (c == '"' || c == '\\')
+			res += string("\\") + c;
+		else if ((unsigned char)c < 0x20)
+			res += ' ';
+		else
+			res += c;
+
+	return res;
+}
+
+/*
+***Description***
+The method converts a binary trace into the trace-event JSON format. Components and separator
+tries become duration events ("B"/"E") on the thread that searched them, so each thread shows
+its search tree as a flame graph; splits into components and cache lookups become instant
+events. Separators and bags are named by the names of their hyperedges and vertices.
+
+INPUT:	in: Binary trace
+OUTPUT: out: Trace-event JSON
+		return: false if the input is no trace or is truncated
+*/
+
+bool SearchTrace::convertToJson(istream &in, ostream &out)
+{
+	static const char *cResults[] = { "failed", "decomposed", "interrupted" };
+	static const char *cCache[] = { "miss", "hit (decomposed)", "hit (failed)" };
+	unordered_map<uint32_t, string> edge_names, vertex_names;
+	char magic[sizeof(cMagic)];
+	vector<uint32_t> ids;
+	string name;
+	Event e;
+	bool first{ true }, complete{ true };
+
+	if (!in.read(magic, sizeof(magic)) || memcmp(magic, cMagic, sizeof(cMagic)) != 0)
+		return false;
+
+	auto result = [](uint32_t Arg) { return Arg < 3 ? cResults[Arg] : "unknown"; };
+
+	out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+	while (in.read((char *)&e, sizeof(e))) {
+		bool is_name = e.Type == Kind::EdgeName || e.Type == Kind::VertexName;
+		if (is_name) {
+			name.resize(e.Count);
+			if (e.Count > 0 && !in.read(&name[0], e.Count)) {
+				complete = false;
+				break;
+			}
+			(e.Type == Kind::EdgeName ? edge_names : vertex_names)[e.Arg] = name;
+			continue;
+		}
+
+		ids.resize(e.Count);
+		if (e.Count > 0 && !in.read((char *)ids.data(), e.Count * sizeof(uint32_t))) {
+			complete = false;
+			break;
+		}
+
+		out << (first ? "" : ",") << endl;
+		first = false;
+		out << "{\"pid\":1,\"tid\":" << e.Thread << ",\"ts\":" << e.Time / 1000.0 << ",";
+
+		switch (e.Type) {
+		case Kind::CompBegin:
+			out << "\"ph\":\"B\",\"cat\":\"component\",\"name\":\"component (" << e.Arg << " edges)\"";
+			out << ",\"args\":{\"level\":" << e.Level << ",\"edges\":" << e.Arg << "}}";
+			break;
+		case Kind::SepBegin:
+		case Kind::BagBegin: {
+			auto &names = e.Type == Kind::SepBegin ? edge_names : vertex_names;
+			name.clear();
+			for (size_t i = 0; i < ids.size(); i++) {
+				auto it = names.find(ids[i]);
+				name += (i > 0 ? "," : "") + (it != names.end() ? it->second : to_string(ids[i]));
+			}
+			out << "\"ph\":\"B\",\"cat\":\"" << (e.Type == Kind::SepBegin ? "separator" : "bag") << "\",";
+			out << "\"name\":\"{" << escapeJson(name) << "}\",\"args\":{\"level\":" << e.Level << "}}";
+			break;
+		}
+		case Kind::CompEnd:
+		case Kind::SepEnd:
+			out << "\"ph\":\"E\",\"args\":{\"result\":\"" << result(e.Arg) << "\"}}";
+			break;
+		case Kind::Split:
+			out << "\"ph\":\"i\",\"s\":\"t\",\"cat\":\"split\",\"name\":\"split (" << e.Arg << " components)\"";
+			out << ",\"args\":{\"level\":" << e.Level << ",\"components\":" << e.Arg << "}}";
+			break;
+		case Kind::Cache:
+			out << "\"ph\":\"i\",\"s\":\"t\",\"cat\":\"cache\",\"name\":\"cache " << (e.Arg < 3 ? cCache[e.Arg] : "unknown");
+			out << "\",\"args\":{\"level\":" << e.Level << "}}";
+			break;
+		default:
+			out << "\"ph\":\"i\",\"s\":\"t\",\"name\":\"unknown event\"}";
+		}
+	}
+	out << endl << "]}" << endl;
+
+	return complete && in.eof() && in.gcount() == 0;
+}
@@ -0,0 +1,118 @@
+#pragma once
+// Records the search tree of the decompositions as a compact binary event log (components,
+// separator tries, splits into components, and cache lookups, each with recursion level,
+// thread, and a timestamp in nanoseconds) and converts such a log into the trace-event JSON
+// format of Chrome (chrome://tracing, Perfetto). Components and separator tries are
+// duration events, so the viewers show the time spent below each separator as a flame graph.
+//
+//////////////////////////////////////////////////////////////////////
+
+#if !defined(CLS_SEARCHTRACE)
+#define CLS_SEARCHTRACE
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "Globals.h"
+#include "Hypergraph.h"
+
+class SearchTrace
+{
+public:
+	// Kinds of events
+	enum class Kind : uint8_t {
+		CompBegin,		// Arg: number of hyperedges of the component
+		CompEnd,		// Arg: Result
+		SepBegin,		// Payload: IDs of the hyperedges of the separator
+		BagBegin,		// Payload: IDs of the vertices of the bag
+		SepEnd,			// Arg: Result (Failed means backtracking)
+		Split,			// Arg: number of components
+		Cache,			// Arg: CacheOutcome
+		EdgeName,		// Arg: ID of a hyperedge, payload: its name
+		VertexName		// Arg: ID of a vertex, payload: its name
+	};
+
+	// Outcomes of components and separator tries
+	enum Result : uint32_t { Failed, Decomposed, Interrupted };
+
+	// Outcomes of cache lookups of components
+	enum CacheOutcome : uint32_t { Miss, HitDecomposed, HitFailed };
+
+	// Record of the log; it is followed by Count 32-bit IDs (or Count characters for names)
+	struct Event {
+		uint64_t Time;
+		uint32_t Arg;
+		uint32_t Count;
+		uint16_t Thread;
+		uint16_t Level;
+		Kind Type;
+		uint8_t Reserved[3];
+	};
+
+	// Records the begin of a component or separator try and its end when leaving the scope
+	class Scope
+	{
+	private:
+		bool MyActive;
+		Kind MyEnd;
+		int MyLevel;
+		uint32_t MyResult{ Failed };
+
+	public:
+		// Component with the given number of hyperedges
+		Scope(int Level, size_t NbrOfEdges) : MyActive{ sEnabled }, MyEnd{ Kind::CompEnd }, MyLevel{ Level } {
+			if (MyActive)
+				write(Kind::CompBegin, Level, (uint32_t)NbrOfEdges);
+		}
+
+		// Separator (Bag = false) or bag (Bag = true) with the given signature
+		Scope(int Level, const vector<uint> &Signature, bool Bag = false) : MyActive{ sEnabled }, MyEnd{ Kind::SepEnd }, MyLevel{ Level } {
+			if (MyActive)
+				write(Bag ? Kind::BagBegin : Kind::SepBegin, Level, 0, Signature.data(), (uint32_t)Signature.size());
+		}
+
+		~Scope() {
+			if (MyActive)
+				write(MyEnd, MyLevel, MyResult);
+		}
+
+		// Sets the outcome written at the end of the scope
+		void setResult(bool Decomposed, bool Interrupted = false) {
+			MyResult = Decomposed ? SearchTrace::Decomposed : Interrupted ? SearchTrace::Interrupted : Failed;
+		}
+	};
+
+private:
+	static bool sEnabled;
+	static FILE *sFile;
+	static mutex sLock;
+	static chrono::steady_clock::time_point sStart;
+
+	static void close();
+
+public:
+	// Starts writing the trace to the given file; the IDs of the hypergraph are named in the log
+	static void enable(const string &File, const HypergraphSharedPtr &Hg);
+
+	// Checks whether the trace is recorded
+	static bool enabled() { return sEnabled; }
+
+	// Writes an event (Count IDs or characters are appended)
+	static void write(Kind Type, int Level, uint32_t Arg, const void *Payload = nullptr, uint32_t Count = 0);
+
+	// Records an event without duration (if the trace is enabled)
+	static void event(Kind Type, int Level, uint32_t Arg) {
+		if (sEnabled)
+			write(Type, Level, Arg);
+	}
+
+	// Converts a binary trace into a Chrome trace-event JSON file; returns false if the input is no trace
+	static bool convertToJson(istream &in, ostream &out);
+};
+
+#endif
@@ -1,40 +1,88 @@
-#include "Separator.h"
-
-void Separator::label(int lbl) const
-{
-	for (auto e : MySep)
-		e->setAllLabels(lbl);
-}
-
-bool Separator::contains(const VertexSharedPtr & v) const
-{
-	for (auto e : MySep) {
-		if (e->find(v) != nullptr)
-			return true;
-	}
-
-	return false;
-}
-
-VertexSet Separator::covers()
-{
-	VertexSet vs;
-
-	for (auto e : MySep)
-		for (auto v : e->allVertices())
-			vs.insert(v);
-
-	return vs;
-}
-
-bool operator==(const  std::shared_ptr<Separator> & lhs, const  std::shared_ptr<Separator> & rhs)
-{
-	if (lhs->size() != rhs->size()) 
-		return false;
-	
-	for (auto e : lhs->edges())
-		if (find(rhs->begin(), rhs->end(), e) == rhs->end())
-			return false;
-
-	return true;
-}
+#include "Separator.h"
+
+Separator::Separator(const HypergraphCoreSharedPtr &core, const HyperedgeVector &sep) : Separator(core)
+{
+	int idx;
+
+	MySep = sep;
+	for (auto &e : MySep) {
+		MySignature.push_back(e->getId());
+		if ((idx = MyCore->edgeIndex(e)) >= 0)
+			MyEdgeIndices.set(idx);
+		for (auto &v : e->allVertices())
+			if ((idx = MyCore->vertexIndex(v)) >= 0)
+				MyCoveredVertices.set(idx);
+	}
+
+	sort(MySignature.begin(), MySignature.end());
+	updateHash();
+}
+
+void Separator::insert(const HyperedgeSharedPtr & ptr)
+{
+	int idx;
+
+	MySep.push_back(ptr);
+	addToSignature(ptr->getId());
+
+	if ((idx = MyCore->edgeIndex(ptr)) >= 0) {
+		MyEdgeIndices.set(idx);
+		for (auto v : MyCore->edgeVertices(idx))
+			MyCoveredVertices.set(v);
+	}
+	else
+		for (auto &v : ptr->allVertices())
+			if ((idx = MyCore->vertexIndex(v)) >= 0)
+				MyCoveredVertices.set(idx);
+}
+
+bool Separator::contains(const HyperedgeSharedPtr & ptr) const
+{
+	int idx = MyCore->edgeIndex(ptr);
+
+	if (idx >= 0 && MyCore->edge(idx) == ptr)
+		return MyEdgeIndices.test(idx);
+
+	return find(MySep.begin(), MySep.end(), ptr) != MySep.end();
+}
+
+bool Separator::contains(const VertexSharedPtr & v) const
+{
+	int idx = MyCore->vertexIndex(v);
+
+	if (idx >= 0 && MyCore->vertex(idx) == v)
+		return MyCoveredVertices.test(idx);
+
+	// Vertices outside the core can only be covered by edges outside the core
+	for (auto e : MySep) {
+		if (e->find(v) != nullptr)
+			return true;
+	}
+
+	return false;
+}
+
+bool Separator::coversAll(const VertexSet & vertices) const
+{
+	for (auto &v : vertices)
+		if (!contains(v))
+			return false;
+
+	return true;
+}
+
+VertexSet Separator::covers()
+{
+	VertexSet vs;
+
+	for (auto e : MySep)
+		for (auto v : e->allVertices())
+			vs.insert(v);
+
+	return vs;
+}
+
+bool operator==(const  std::shared_ptr<Separator> & lhs, const  std::shared_ptr<Separator> & rhs)
+{
+	return SeparatorEqual()(lhs, rhs);
+}
@@ -0,0 +1,72 @@
+#include "SeparatorCache.h"
+
+void CompCache::insertSucc(const CompFingerprint &fp)
+{
+	if (succ.insert(fp).second)
+		charge(fingerprintBytes(fp));
+}
+
+void CompCache::insertFailed(const CompFingerprint &fp)
+{
+	if (failed.insert(fp).second)
+		charge(fingerprintBytes(fp));
+}
+
+void CompCache::setSuccFW(const CompFingerprint &fp, double FW)
+{
+	auto res = succFW.emplace(fp, FW);
+
+	if (res.second)
+		charge(fingerprintBytes(fp) + sizeof(double));
+	else
+		res.first->second = FW;
+}
+
+void CompCache::clearSucc()
+{
+	size_t freed{ 0 };
+
+	for (auto &fp : succ)
+		freed += fingerprintBytes(fp);
+	for (auto &entry : succFW)
+		freed += fingerprintBytes(entry.first) + sizeof(double);
+
+	succ.clear();
+	succFW.clear();
+	release(freed);
+}
+
+void CompCache::clearFailed()
+{
+	size_t freed{ 0 };
+
+	for (auto &fp : failed)
+		freed += fingerprintBytes(fp);
+
+	failed.clear();
+	release(freed);
+}
+
+void CompCache::charge(size_t Bytes)
+{
+	bytes += Bytes;
+	if (owner != nullptr) {
+		*owner += Bytes;
+		SearchStats::addCacheBytes(Bytes);
+	}
+}
+
+void CompCache::release(size_t Bytes)
+{
+	bytes -= Bytes;
+	if (owner != nullptr) {
+		*owner -= Bytes;
+		SearchStats::releaseCacheBytes(Bytes);
+	}
+}
+
+size_t CompCache::fingerprintBytes(const CompFingerprint &fp)
+{
+	// Fingerprint, its ID vectors, and the node of the hash set
+	return sizeof(CompFingerprint) + 2 * sizeof(void *) + (fp.edges.size() + fp.connector.size()) * sizeof(uint);
+}
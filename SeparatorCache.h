@@ -0,0 +1,159 @@
+#pragma once
+// Models the cache of the components of tried separators, i.e., the components of each
+// separator that are known to be decomposable or undecomposable. The memory of the cached
+// components is estimated in bytes; if it exceeds a limit, the separators used least recently
+// are evicted together with their components.
+//
+//////////////////////////////////////////////////////////////////////
+
+#if !defined(CLS_SEPARATORCACHE)
+#define CLS_SEPARATORCACHE
+
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "Globals.h"
+#include "BaseSeparator.h"
+#include "DecompComponent.h"
+#include "SearchStats.h"
+
+struct CompCache {
+	// Separator components already successfully decomposed
+	CompFingerprintSet succ;
+	// fractional width for succ components
+	unordered_map<CompFingerprint, double, CompFingerprintHash> succFW;
+	// Separator components not decomposable
+	CompFingerprintSet failed;
+	// Protects the sets if components are decomposed concurrently
+	mutex lock;
+
+	// Estimated memory of the entry in bytes
+	size_t bytes{ 0 };
+	// Memory of the cache holding the entry (nullptr once the entry has been evicted)
+	atomic<size_t> *owner{ nullptr };
+
+	// Add or remove components (lock has to be held); the memory is charged to the owner
+	void insertSucc(const CompFingerprint &fp);
+	void insertFailed(const CompFingerprint &fp);
+	void setSuccFW(const CompFingerprint &fp, double FW);
+	void clearSucc();
+	void clearFailed();
+
+	// Adds resp. removes memory of the entry
+	void charge(size_t Bytes);
+	void release(size_t Bytes);
+
+	// Returns the estimated memory of a cached component
+	static size_t fingerprintBytes(const CompFingerprint &fp);
+};
+
+using CompCacheSharedPtr = std::shared_ptr<CompCache>;
+
+template <typename SepPtr>
+class SeparatorCache
+{
+private:
+	struct Entry {
+		SepPtr Sep;
+		CompCacheSharedPtr Cache;
+	};
+
+	// Entries ordered by their last use (most recently used first)
+	list<Entry> MyEntries;
+	unordered_map<SepPtr, typename list<Entry>::iterator, SeparatorHash, SeparatorEqual> MyIndex;
+
+	// Estimated memory of all entries and its limit in bytes (0 if unlimited)
+	atomic<size_t> MyBytes{ 0 };
+	size_t MyLimit{ 0 };
+
+	// Number of separators found resp. not found and of evicted separators
+	size_t MyHits{ 0 };
+	size_t MyMisses{ 0 };
+	size_t MyEvictions{ 0 };
+
+	mutable mutex MyLock;
+
+	// Removes the least recently used entry (Evicted: the entry is removed to meet the limit)
+	void removeLast(bool Evicted) {
+		CompCache &cache = *MyEntries.back().Cache;
+		{
+			// The entry may still be used by the search, but no longer counts for the cache
+			lock_guard<mutex> guard(cache.lock);
+			cache.release(cache.bytes);
+			cache.owner = nullptr;
+		}
+		MyIndex.erase(MyEntries.back().Sep);
+		MyEntries.pop_back();
+		if (Evicted) {
+			MyEvictions++;
+			SearchStats::count(SearchStats::Counter::CacheEvictions);
+		}
+	}
+
+public:
+	SeparatorCache() {}
+	~SeparatorCache() { clear(); }
+
+	// Returns the entry of a separator (a new one if there is none) and replaces the separator
+	// by the equal one in the cache; the entry stays valid while it is used, even if it is evicted
+	CompCacheSharedPtr get(SepPtr &Sep) {
+		lock_guard<mutex> guard(MyLock);
+		auto it = MyIndex.find(Sep);
+
+		if (it != MyIndex.end()) {
+			MyHits++;
+			SearchStats::count(SearchStats::Counter::SepCacheHits);
+			MyEntries.splice(MyEntries.begin(), MyEntries, it->second);
+			Sep = it->second->Sep;
+			return it->second->Cache;
+		}
+
+		MyMisses++;
+		SearchStats::count(SearchStats::Counter::SepCacheMisses);
+		CompCacheSharedPtr cache = make_shared<CompCache>();
+		cache->owner = &MyBytes;
+		cache->charge(sizeof(Entry) + sizeof(CompCache) + 4 * sizeof(void *) + Sep->signature().size() * (sizeof(uint) + sizeof(SepPtr)));
+		MyEntries.push_front({ Sep, cache });
+		MyIndex[Sep] = MyEntries.begin();
+
+		// Entries grow after they were returned, so the limit is enforced at the next access
+		while (MyLimit > 0 && MyBytes > MyLimit && MyEntries.size() > 1)
+			removeLast(true);
+
+		return cache;
+	}
+
+	// Calls F for the entry of each separator
+	template <typename F>
+	void forEach(F f) {
+		lock_guard<mutex> guard(MyLock);
+		for (auto &entry : MyEntries) {
+			lock_guard<mutex> cache_guard(entry.Cache->lock);
+			f(*entry.Cache);
+		}
+	}
+
+	// Removes all entries
+	void clear() {
+		lock_guard<mutex> guard(MyLock);
+		while (!MyEntries.empty())
+			removeLast(false);
+	}
+
+	// Limits the estimated memory of the cache (0 if unlimited)
+	void setLimit(size_t Bytes) {
+		lock_guard<mutex> guard(MyLock);
+		MyLimit = Bytes;
+	}
+
+	size_t bytes() const { return MyBytes; }
+	size_t size() const { lock_guard<mutex> guard(MyLock); return MyEntries.size(); }
+	size_t hits() const { lock_guard<mutex> guard(MyLock); return MyHits; }
+	size_t misses() const { lock_guard<mutex> guard(MyLock); return MyMisses; }
+	size_t evictions() const { lock_guard<mutex> guard(MyLock); return MyEvictions; }
+};
+
+#endif
@@ -21,7 +21,7 @@ using namespace std;
 //////////////////////////////////////////////////////////////////////
 
 
-SetCover::SetCover(const HypergraphSharedPtr &H) : MyH { H }
+SetCover::SetCover(const HypergraphSharedPtr &H) : MyH { H }, MyContext{ H->core() }
 {
 }
 
@@ -48,27 +48,27 @@ HyperedgeSet SetCover::NodeCover1(const VertexSet &Vertices, const HyperedgeSet
 	iNbrOfUncovNodes = Vertices.size();
 
 	// Clear labels on hypergraph (hide all vertices and edges)
-	MyH->setAllLabels(-1);
+	MyContext.resetLabels(-1);
 
 	// Unhide vertices to be covered
 	for (auto v : Vertices) {
 		/* for (auto it = MyH->getVertexNeighborsBegin(v); it != MyH->getVertexNeighborsEnd(v); it++)
 			(*it)->setLabel(-1); */
-		v->setLabel(0);
+		MyContext.setLabel(v, 0);
 	}
 		
 	// Unhide edges that can be used to cover the vertices
 	for (auto he : HEdges)
-		he->setLabel(0);
+		MyContext.setLabel(he, 0);
 
 	// STEP 1: Choose all hyperedges that cover a node which is not contained in any other hyperedge
 	for(auto v : Vertices) {
 		// Check if vertex is already covered
-		if (v->getLabel() == 0) {
+		if (MyContext.label(v) == 0) {
 			// Check whether there is only one hyperedge that covers the node
 			hedge = nullptr;
 			for (auto he : MyH->allVertexNeighbors(v))
-				if(he->getLabel() != -1)
+				if(MyContext.label(he) != -1)
 					if(hedge != nullptr) {
 						hedge = nullptr;
 						break;
@@ -78,13 +78,13 @@ HyperedgeSet SetCover::NodeCover1(const VertexSet &Vertices, const HyperedgeSet
 		
 			if(hedge != nullptr) {
 				++iNbrOfCovEdges;
-				hedge->setLabel(-1);
+				MyContext.setLabel(hedge, -1);
 				CovEdges.insert(hedge);
 			
 				// Mark vertices covered by the chosen edge
 				for (auto v : hedge->allVertices()) {
-					if (v->getLabel() > 0 && Vertices.find(v) != Vertices.end()) {
-						v->setLabel(-1);
+					if (MyContext.label(v) > 0 && Vertices.find(v) != Vertices.end()) {
+						MyContext.setLabel(v, -1);
 						--iNbrOfUncovNodes;
 					}
 				}
@@ -96,26 +96,26 @@ HyperedgeSet SetCover::NodeCover1(const VertexSet &Vertices, const HyperedgeSet
 	while(iNbrOfUncovNodes > 0) {
 		// Label each hyperedge with the number of uncovered nodes it covers
 		for (auto v : Vertices)
-			if (v->getLabel() == 0)
+			if (MyContext.label(v) == 0)
 				for (auto he : MyH->allVertexNeighbors(v))
-					if (he->getLabel() >= 0)
-						he->incLabel();
+					if (MyContext.label(he) >= 0)
+						MyContext.incLabel(he);
 
 		// Search for the hyperedges with the maximum labeling
 		iMax = -1;
 		for(auto he : HEdges) {
-			if(he->getLabel() > iMax) {
+			if(MyContext.label(he) > iMax) {
 				CovCand.clear();
 				CovCand.push_back(he);
-				iMax = he->getLabel();
+				iMax = MyContext.label(he);
 			}
 			else
-				if(he->getLabel() == iMax)
+				if(MyContext.label(he) == iMax)
 					CovCand.push_back(he);
 
 			// Reset hyperedge labels
-			if(he->getLabel() > 0)
-				he->setLabel(0);
+			if(MyContext.label(he) > 0)
+				MyContext.setLabel(he, 0);
 		}
 
 		// Select a hyperedge with maximum labeling
@@ -130,13 +130,13 @@ HyperedgeSet SetCover::NodeCover1(const VertexSet &Vertices, const HyperedgeSet
 		CovCand.clear();
 
 		++iNbrOfCovEdges;
-		hedge->setLabel(-1);
+		MyContext.setLabel(hedge, -1);
 		CovEdges.insert(hedge);
 
 		// Mark vertices covered by the chosen edge
 		for (auto v : hedge->allVertices()) {
-			if (v->getLabel() > 0 && Vertices.find(v) != Vertices.end()) {
-				v->setLabel(-1);
+			if (MyContext.label(v) > 0 && Vertices.find(v) != Vertices.end()) {
+				MyContext.setLabel(v, -1);
 				--iNbrOfUncovNodes;
 			}
 		}
@@ -166,35 +166,35 @@ HyperedgeSet SetCover::NodeCover2(const VertexSet &Vertices, const HyperedgeSet
 	EdgeWeights.reserve(Nodes.size());
 	*/
 
-	MyH->setAllLabels(-1);
+	MyContext.resetLabels(-1);
 
 	// Compute the node weights
 	for(auto v : Vertices) {
 		iContained = 0;
 		for (auto he : MyH->allVertexNeighbors(v)) {
-			he->setLabel(-1);
+			MyContext.setLabel(he, -1);
 			if(HEdges.find(he)!=HEdges.end())
 				++iContained;
 		}
-		v->setLabel(0);
+		MyContext.setLabel(v, 0);
 		NodeWeights[v] = 1.0 - ((double)iContained / (double)HEdges.size());
 	}
 
 	// Label each edge with its index in the EdgeWeights array
 	i = 0;
 	for(auto he : HEdges) {
-		he->setLabel(i++);
+		MyContext.setLabel(he, i++);
 		EdgeWeights[he] = 0;
 	}
 
 	// STEP 1: Choose all hyperedges that cover a node which is not contained in any other hyperedge
 	for (auto v : Vertices) {
 		// Check if vertex is already covered
-		if (v->getLabel() == 0) {
+		if (MyContext.label(v) == 0) {
 			// Check whether there is only one hyperedge that covers the node
 			hedge = nullptr;
 			for (auto he : MyH->allVertexNeighbors(v))
-				if (he->getLabel() != -1)
+				if (MyContext.label(he) != -1)
 					if (hedge != nullptr) {
 						hedge = nullptr;
 						break;
@@ -204,14 +204,14 @@ HyperedgeSet SetCover::NodeCover2(const VertexSet &Vertices, const HyperedgeSet
 
 			if (hedge != nullptr) {
 				++iNbrOfCovEdges;
-				hedge->setLabel(-1);
+				MyContext.setLabel(hedge, -1);
 				CovEdges.insert(hedge);
 
 				// Mark vertices covered by the chosen edge
 				for (auto v : hedge->allVertices()) {
-					if (v->getLabel() > 0 && Vertices.find(v) != Vertices.end()) {
+					if (MyContext.label(v) > 0 && Vertices.find(v) != Vertices.end()) {
 						NodeWeights[v] = 0;
-						v->setLabel(-1);
+						MyContext.setLabel(v, -1);
 						--iNbrOfUncovNodes;
 					}
 				}
@@ -223,7 +223,7 @@ HyperedgeSet SetCover::NodeCover2(const VertexSet &Vertices, const HyperedgeSet
 	for(auto v : Vertices)
 		if(NodeWeights[v] > 0)
 			for(auto he : MyH->allVertexNeighbors(v))
-				if(he->getLabel() >= 0)
+				if(MyContext.label(he) >= 0)
 					EdgeWeights[he] += NodeWeights[v];
 
 	// STEP 2: Choose iteratively hyperedges that have the highest weight
@@ -231,7 +231,7 @@ HyperedgeSet SetCover::NodeCover2(const VertexSet &Vertices, const HyperedgeSet
 		// Search for the hyperedge with the highest weight
 		iMax = -1;
 		for(auto he : HEdges)
-			if (he->getLabel() >= 0)
+			if (MyContext.label(he) >= 0)
 				if (EdgeWeights[he] > iMax) {
 					CovCand.clear();
 					CovCand.push_back(he);
@@ -254,17 +254,17 @@ HyperedgeSet SetCover::NodeCover2(const VertexSet &Vertices, const HyperedgeSet
 
 		++iNbrOfCovEdges;
 		EdgeWeights[hedge] = 0;
-		hedge->setLabel(-1);
+		MyContext.setLabel(hedge, -1);
 		CovEdges.insert(hedge);
 
 		// Reset the node weight of covered nodes and update the hyperedge weights
 		for (auto v : hedge->allVertices()) {
-			if (v->getLabel() > 0 && Vertices.find(v) != Vertices.end()) {
+			if (MyContext.label(v) > 0 && Vertices.find(v) != Vertices.end()) {
 				for (auto he : MyH->allVertexNeighbors(v))
-					if (he->getLabel() >= 0)
+					if (MyContext.label(he) >= 0)
 						EdgeWeights[he] -= NodeWeights[v];
 				NodeWeights[v] = 0;
-				v->setLabel(-1);
+				MyContext.setLabel(v, -1);
 				--iNbrOfUncovNodes;
 			}
 		}
@@ -278,16 +278,16 @@ bool SetCover::covers(const VertexSet &Vertices, const HyperedgeSet &HEdges)
 {
 	// Reset node labels
 	for(auto v : Vertices)
-		v->setLabel(0);
+		MyContext.setLabel(v, 0);
 
 	// Mark all nodes that can be covered
 	for(auto he : HEdges)
 		for(auto v : he->allVertices())
-			v->setLabel(1);
+			MyContext.setLabel(v, 1);
 
 	// Check whether there are unmarked nodes
 	for(auto v : Vertices)
-		if(v->getLabel() == 0)
+		if(MyContext.label(v) == 0)
 			return false;
 
 	return true;
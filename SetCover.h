@@ -12,12 +12,16 @@
 #include "Vertex.h"
 #include "Hyperedge.h"
 #include "Hypergraph.h"
+#include "SearchContext.h"
 
 class SetCover  
 {
 private:
 	HypergraphSharedPtr MyH;
 
+	// Labels of vertices and edges used by the covering algorithms
+	SearchContext MyContext;
+
 	// Covers a set of nodes by a set of hyperedges
 	HyperedgeSet NodeCover1(const VertexSet &Vertices, const HyperedgeSet &HEdges, bool bDeterm);
 
@@ -22,13 +22,14 @@ SubedgeSeparatorFactory::~SubedgeSeparatorFactory()
 }
 
 
-void SubedgeSeparatorFactory::init(const HypergraphSharedPtr &hg, const HyperedgeVector &comp, const SeparatorSharedPtr &sep, const unique_ptr<Subedges> &subs)
+void SubedgeSeparatorFactory::init(SearchContext &ctx, const HyperedgeVector &comp, const SeparatorSharedPtr &sep, const unique_ptr<Subedges> &subs)
 {
-	hg->setAllLabels();
+	ctx.resetLabels();
+	MyCore = sep->core();
 
 	//Label the component
 	for (auto he : comp)
-		he->setAllLabels(1);
+		ctx.setAllLabels(he, 1);
 
 	//Now initialize sub edges of this separator
 	for (auto &he : sep->edges()) {
@@ -41,7 +42,7 @@ void SubedgeSeparatorFactory::init(const HypergraphSharedPtr &hg, const Hyperedg
 			//check if sub edge covers part of component
 			bool found = false;
 			for (auto v : sub->allVertices())
-				if (v->getLabel() == 1) {
+				if (ctx.label(v) == 1) {
 					found = true;
 					break;
 				}
@@ -58,7 +59,7 @@ void SubedgeSeparatorFactory::init(const HypergraphSharedPtr &hg, const Hyperedg
 
 SeparatorSharedPtr SubedgeSeparatorFactory::next() {
 	bool inc = false;
-	SeparatorSharedPtr sep = make_shared<Separator>();
+	SeparatorSharedPtr sep = make_shared<Separator>(MyCore);
 
 	if (!MyInit)
 		writeErrorMsg("SubedgeSeparatorFactory not initialized!", "SubedgeSeparatorFactory::next()");
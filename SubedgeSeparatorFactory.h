@@ -9,18 +9,20 @@
 #include "Vertex.h"
 #include "Subedges.h"
 #include "Separator.h"
+#include "SearchContext.h"
 
 class SubedgeSeparatorFactory
 {
 	vector<HyperedgeVector> MySubSets;
 	vector<int> MyState;
 	bool MyInit{ false };
+	HypergraphCoreSharedPtr MyCore;
 
 public:
 	SubedgeSeparatorFactory();
 	~SubedgeSeparatorFactory();
 
-	void init(const HypergraphSharedPtr &hg, const HyperedgeVector &comp, const SeparatorSharedPtr &sep, const unique_ptr<Subedges> &subs);
+	void init(SearchContext &ctx, const HyperedgeVector &comp, const SeparatorSharedPtr &sep, const unique_ptr<Subedges> &subs);
 	SeparatorSharedPtr next();
 };
 
@@ -8,6 +8,7 @@
 
 list<HyperedgeSharedPtr> AllSubedges;
 int iSub{ 0 };
+mutex Subedges::AllSubedgesLock;
 
 
 void Subedges::init(const HyperedgeSharedPtr &he)
@@ -54,6 +55,8 @@ void Subedges::init(const HyperedgeSharedPtr &he)
 							new_edge = e;
 
 					if (new_edge == nullptr) {
+						lock_guard<mutex> guard(AllSubedgesLock);
+
 						//Now check if subedge was already created from
 						//a different edge
 						for (auto e : AllSubedges)
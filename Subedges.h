@@ -3,6 +3,7 @@
 //
 //////////////////////////////////////////////////////////////////////
 
+#include<mutex>
 #include<unordered_map>
 
 #include "Globals.h"
@@ -22,6 +23,9 @@ private:
 	int MyK;
 	unordered_map<HyperedgeSharedPtr, HyperedgeVector, NamedEntityHash> MySubedges;
 
+	// Guards the subedges shared by all instances, which are created by concurrent searches
+	static mutex AllSubedgesLock;
+
 public:
 	Subedges(const HypergraphSharedPtr &hg, int k) : MyHg{ hg }, MyK{ k } { }
 	//HE_VEC* getSubedges(Hyperedge *he);
@@ -42,8 +42,6 @@ public:
 	virtual bool isHeavy() const { return true; }
 	virtual size_t getWeight() const { return Edges.size(); }
 
-	virtual void setAllLabels(int label = 0) const;
-
 	friend std::ostream& operator<< (std::ostream& stream, const std::shared_ptr<Superedge>& super);
 };
 
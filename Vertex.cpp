@@ -1,31 +1,32 @@
-#include <algorithm>
-#include<unordered_set>
-#include<set>
-#include<vector>
-#include<string>
-#include<set>
-#include<iterator>
-
-#include "Vertex.h"
-
-
-int G_VertexID = 0;
-
-Vertex::Vertex(const string & name) : Vertex(++G_VertexID, name)
-{
-}
-
-Vertex::~Vertex()
-{
-}
-
-std::ostream & operator<<(std::ostream & out, const Vertex & v)
-{
-	out << v.getName();
-
-	return out;
-}
-
+#include <iostream>
+#include <algorithm>
+#include<unordered_set>
+#include<set>
+#include<vector>
+#include<string>
+#include<set>
+#include<iterator>
+
+#include "Vertex.h"
+
+
+int G_VertexID = 0;
+
+Vertex::Vertex(const string & name) : Vertex(++G_VertexID, name)
+{
+}
+
+Vertex::~Vertex()
+{
+}
+
+std::ostream & operator<<(std::ostream & out, const Vertex & v)
+{
+	out << v.getName();
+
+	return out;
+}
+
 std::ostream & operator<<(std::ostream & out, const VertexSet & v)
 {
 	out << "(";
@@ -1,25 +1,79 @@
-#include "VertexSeparator.h"
-
-
-bool VertexSeparator::contains(const HyperedgeSharedPtr & ptr) const
-{
-	for (auto &v : ptr->allVertices())
-		if (MySep.find(v) == MySep.end())
-			return false;
-
-	return true;
-}
-
-std::ostream & operator<<(std::ostream & out, const shared_ptr<VertexSeparator> & ptr)
-{
-	out << "{ ";
-	for (auto it = ptr->vertices().begin(); it != ptr->vertices().end();) {
-		out << (*it)->getName();
-		it++;
-		if (it != ptr->vertices().end())
-			out << ", ";
-		else
-			out << " }";
-	}
-	return out;
-}
+#include "VertexSeparator.h"
+
+VertexSeparator::VertexSeparator(const HypergraphCoreSharedPtr &core, const VertexSet &sep) : BaseSeparator(core), MySep{ sep }
+{
+	int idx;
+
+	for (auto &v : MySep) {
+		MySignature.push_back(v->getId());
+		if ((idx = MyCore->vertexIndex(v)) >= 0)
+			MyCoveredVertices.set(idx);
+	}
+
+	sort(MySignature.begin(), MySignature.end());
+	updateHash();
+}
+
+void VertexSeparator::insert(const VertexSharedPtr & ptr)
+{
+	int idx;
+
+	if (MySep.insert(ptr).second) {
+		addToSignature(ptr->getId());
+		if ((idx = MyCore->vertexIndex(ptr)) >= 0)
+			MyCoveredVertices.set(idx);
+	}
+}
+
+void VertexSeparator::erase(const VertexSharedPtr & ptr)
+{
+	int idx;
+
+	if (MySep.erase(ptr) > 0) {
+		removeFromSignature(ptr->getId());
+		if ((idx = MyCore->vertexIndex(ptr)) >= 0)
+			MyCoveredVertices.reset(idx);
+	}
+}
+
+bool VertexSeparator::contains(const VertexSharedPtr & v) const
+{
+	int idx = MyCore->vertexIndex(v);
+
+	if (idx >= 0 && MyCore->vertex(idx) == v)
+		return MyCoveredVertices.test(idx);
+
+	return MySep.find(v) != MySep.end();
+}
+
+bool VertexSeparator::contains(const HyperedgeSharedPtr & ptr) const
+{
+	int idx = MyCore->edgeIndex(ptr);
+
+	if (idx >= 0 && MyCore->edge(idx) == ptr) {
+		for (auto v : MyCore->edgeVertices(idx))
+			if (!MyCoveredVertices.test(v))
+				return false;
+		return true;
+	}
+
+	for (auto &v : ptr->allVertices())
+		if (!contains(v))
+			return false;
+
+	return true;
+}
+
+std::ostream & operator<<(std::ostream & out, const shared_ptr<VertexSeparator> & ptr)
+{
+	out << "{ ";
+	for (auto it = ptr->vertices().begin(); it != ptr->vertices().end();) {
+		out << (*it)->getName();
+		it++;
+		if (it != ptr->vertices().end())
+			out << ", ";
+		else
+			out << " }";
+	}
+	return out;
+}
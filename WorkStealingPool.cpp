@@ -0,0 +1,132 @@
+#include <chrono>
+
+#include "WorkStealingPool.h"
+
+thread_local int WorkStealingPool::tWorker{ -1 };
+thread_local const WorkStealingPool *WorkStealingPool::tPool{ nullptr };
+thread_local TaskGroup *TaskGroup::tCurrent{ nullptr };
+
+WorkStealingPool::WorkStealingPool(size_t nbrOfThreads)
+{
+	if (nbrOfThreads == 0)
+		nbrOfThreads = 1;
+
+	// Queue 0 belongs to the threads outside the pool
+	for (size_t i = 0; i < nbrOfThreads; i++)
+		MyQueues.push_back(make_unique<Queue>());
+
+	for (size_t i = 1; i < nbrOfThreads; i++)
+		MyThreads.emplace_back(&WorkStealingPool::work, this, (int)i - 1);
+}
+
+WorkStealingPool::~WorkStealingPool()
+{
+	{
+		lock_guard<mutex> guard(MyIdleLock);
+		MyStop = true;
+	}
+	MyIdle.notify_all();
+
+	for (auto &t : MyThreads)
+		t.join();
+}
+
+void WorkStealingPool::work(int worker)
+{
+	tWorker = worker;
+	tPool = this;
+
+	while (!MyStop) {
+		if (!runPendingTask()) {
+			unique_lock<mutex> guard(MyIdleLock);
+			MyIdle.wait_for(guard, chrono::milliseconds(10), [this] { return MyStop || MyQueued > 0; });
+		}
+	}
+}
+
+bool WorkStealingPool::popTask(size_t queue, bool back, function<void()> &task)
+{
+	Queue &q = *MyQueues[queue];
+	lock_guard<mutex> guard(q.Lock);
+
+	if (q.Tasks.empty())
+		return false;
+
+	if (back) {
+		task = move(q.Tasks.back());
+		q.Tasks.pop_back();
+	}
+	else {
+		task = move(q.Tasks.front());
+		q.Tasks.pop_front();
+	}
+	--MyQueued;
+
+	return true;
+}
+
+void WorkStealingPool::submit(function<void()> task)
+{
+	Queue &q = *MyQueues[currentThread()];
+
+	{
+		lock_guard<mutex> guard(q.Lock);
+		q.Tasks.push_back(move(task));
+	}
+	++MyQueued;
+	MyIdle.notify_one();
+}
+
+bool WorkStealingPool::runPendingTask()
+{
+	size_t own = currentThread();
+	size_t cnt = MyQueues.size();
+	function<void()> task;
+
+	// Take the most recent own task (depth-first), otherwise steal the oldest task of another thread
+	if (!popTask(own, true, task)) {
+		size_t start = MyNextQueue++;
+		bool found = false;
+		for (size_t i = 0; !found && i < cnt; i++) {
+			size_t victim = (start + i) % cnt;
+			if (victim != own)
+				found = popTask(victim, false, task);
+		}
+		if (!found)
+			return false;
+	}
+
+	task();
+	return true;
+}
+
+void TaskGroup::run(function<void()> task)
+{
+	++MyPending;
+	MyPool.submit([this, task] {
+		TaskGroup *outer = tCurrent;
+
+		tCurrent = this;
+		if (!isCancelled())
+			task();
+		tCurrent = outer;
+
+		--MyPending;
+	});
+}
+
+void TaskGroup::wait()
+{
+	while (MyPending > 0)
+		if (!MyPool.runPendingTask())
+			this_thread::yield();
+}
+
+bool TaskGroup::isCancelled() const
+{
+	for (const TaskGroup *group = this; group != nullptr; group = group->MyParent)
+		if (group->MyCancelled)
+			return true;
+
+	return false;
+}
@@ -0,0 +1,107 @@
+#pragma once
+// Models a pool of worker threads that execute tasks; idle workers steal tasks from the
+// queues of other workers. Tasks are organized in task groups that can be cancelled.
+//
+//////////////////////////////////////////////////////////////////////
+
+#if !defined(CLS_WORKSTEALINGPOOL)
+#define CLS_WORKSTEALINGPOOL
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Globals.h"
+
+class TaskGroup;
+
+class WorkStealingPool
+{
+private:
+	// Task queue of a worker; the owner works at the back, thieves steal from the front
+	struct Queue {
+		mutex Lock;
+		deque<function<void()>> Tasks;
+	};
+
+	vector<unique_ptr<Queue>> MyQueues;
+	vector<thread> MyThreads;
+
+	// Number of queued tasks (used to put idle workers to sleep)
+	atomic<size_t> MyQueued{ 0 };
+	atomic<bool> MyStop{ false };
+	mutex MyIdleLock;
+	condition_variable MyIdle;
+
+	// Queue for tasks submitted by threads outside the pool
+	atomic<size_t> MyNextQueue{ 0 };
+
+	// Worker index of the current thread (-1 if it does not belong to a pool)
+	static thread_local int tWorker;
+	static thread_local const WorkStealingPool *tPool;
+
+	void work(int worker);
+
+	// Removes a task from the queue of the given worker (from the back or the front)
+	bool popTask(size_t queue, bool back, function<void()> &task);
+
+public:
+	// Creates a pool with the given number of threads (including the thread that waits for tasks)
+	WorkStealingPool(size_t nbrOfThreads);
+	~WorkStealingPool();
+
+	// Returns the number of threads working on tasks (including the waiting thread)
+	size_t nbrOfThreads() const { return MyQueues.size(); }
+
+	// Returns the index of the current thread in [0, nbrOfThreads()); the thread that
+	// created the pool (or any other thread outside the pool) has index 0
+	size_t currentThread() const { return tPool == this ? (size_t)tWorker + 1 : 0; }
+
+	// Queues a task
+	void submit(function<void()> task);
+
+	// Executes a queued task (own tasks first, otherwise a stolen one); returns false if there is none
+	bool runPendingTask();
+};
+
+class TaskGroup
+{
+private:
+	WorkStealingPool &MyPool;
+	TaskGroup *MyParent;
+	atomic<size_t> MyPending{ 0 };
+	atomic<bool> MyCancelled{ false };
+
+	// Task group of the task executed by the current thread
+	static thread_local TaskGroup *tCurrent;
+
+public:
+	// Creates a task group nested in the group of the current task
+	TaskGroup(WorkStealingPool &pool) : MyPool(pool), MyParent{ tCurrent } { }
+	~TaskGroup() { wait(); }
+
+	// Queues a task of this group; tasks of cancelled groups are skipped
+	void run(function<void()> task);
+
+	// Waits until all tasks of the group are done and executes queued tasks in the meantime
+	void wait();
+
+	// Returns the number of tasks not yet finished
+	size_t pending() const { return MyPending; }
+
+	// Cancels all tasks of this group and all nested groups
+	void cancel() { MyCancelled = true; }
+
+	// Checks whether this group or some enclosing group was cancelled
+	bool isCancelled() const;
+
+	// Checks whether the task executed by the current thread was cancelled
+	static bool cancelled() { return tCurrent != nullptr && tCurrent->isCancelled(); }
+};
+
+#endif
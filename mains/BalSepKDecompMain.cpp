@@ -35,6 +35,8 @@
 #include <ctime>
 #include <list>
 #include <cstring>
+#include <mutex>
+#include <sstream>
 
 using namespace std;
 
@@ -44,16 +46,45 @@ using namespace std;
 #include "../Vertex.h"
 #include "../Hyperedge.h"
 #include "../Globals.h"
+#include "../SearchBudget.h"
+#include "../SearchStats.h"
+#include "../SearchTrace.h"
+#include "../Preprocessor.h"
+#include "../BlockDecomp.h"
 #include "../DetKDecomp.h"
 #include "../BalKDecomp.h"
 #include "../Subedges.h"
 
 void usage(int, char **, int *, bool *);
-HypertreeSharedPtr decompK(const HypergraphSharedPtr&, int);
+HypertreeSharedPtr decompK(const HypergraphSharedPtr&, int, const VertexSet & = VertexSet(), ostream & = cout);
 
 
 char *cInpFile, *cOutFile;
 
+// File the search tree is traced to (nullptr if it is not traced)
+char *cTraceFile = nullptr;
+
+// Tries the widths 1, ..., k in turn and stops at the first one that admits a decomposition
+bool bMinWidth = false;
+
+// Reduces the hypergraph before the decomposition and lifts the hypertree afterwards
+bool bPreprocess = false;
+
+// Decomposes the connected components (bBlocks) or the blocks joined at cut vertices (bBiconnected) separately
+bool bBlocks = false, bBiconnected = false;
+
+// Heuristic for ordering the hyperedges before the search
+EdgeOrder Order = EdgeOrder::MCS;
+
+// Budget of the search (0 if unlimited): wall-clock time in seconds, number of separators, memory in MB
+int iTimeLimit = 0, iMaxSeps = 0, iMaxMem = 0;
+
+// Memory of the caches of decomposable and undecomposable components in MB (0 if unlimited)
+int iCacheMem = 0;
+
+// Budget created from the limits (nullptr if the search is unlimited)
+SearchBudgetSharedPtr Budget;
+
 
 
 int main(int argc, char **argv)
@@ -64,12 +95,17 @@ int main(int argc, char **argv)
 	HypergraphSharedPtr HG = make_shared<Hypergraph>();
 	Parser *P;
 	HypertreeSharedPtr HT;
+	Preprocessor Prep;
 
 
 	cout << "*** balsep-k-decomp (version 2.0) ***" << endl << endl;
 
 	// Check command line arguments and initialize random number generator
 	usage(argc, argv, &K, &bDef);
+
+	// Start the budget before parsing such that the time limit covers the whole run
+	if (iTimeLimit > 0 || iMaxSeps > 0 || iMaxMem > 0)
+		Budget = make_shared<SearchBudget>(iTimeLimit, iMaxSeps, iMaxMem);
 	//srand(200);
 	srand((unsigned int)time(NULL));
 	iRandomInit = random_range(999, 9999);
@@ -97,7 +133,57 @@ int main(int argc, char **argv)
 	cout << "Building hypergraph done in " << difftime(end, start) << " sec." << endl << endl;
 	delete P;
 
-	HT = decompK(HG, K);
+	// Start the trace once the names of the hyperedges and vertices are known
+	if (cTraceFile != nullptr)
+		SearchTrace::enable(cTraceFile, HG);
+
+	// Reduce the hypergraph
+	HypergraphSharedPtr Reduced = HG;
+	if (bPreprocess) {
+		cout << "Preprocessing hypergraph ... " << endl;
+		time(&start);
+		Reduced = Prep.reduce(HG);
+		time(&end);
+		cout << "Preprocessing hypergraph done in " << difftime(end, start) << " sec";
+		cout << " (" << Reduced->getNbrOfEdges() << " edges, " << Reduced->getNbrOfVertices() << " vertices)." << endl;
+		Prep.writeStats(cout);
+		cout << endl;
+	}
+
+	if (bBlocks || bBiconnected) {
+		BlockDecomp Blocks(Reduced, bBiconnected);
+		cout << "Hypergraph split into " << Blocks.nbrOfBlocks() << " blocks";
+		cout << " (largest block: " << Blocks.maxBlockSize() << " edges)." << endl << endl;
+		mutex out_lock;
+		time(&start);
+		HT = Blocks.buildHypertree([K, &out_lock](const HypergraphSharedPtr &Block, const VertexSet &Root) {
+			HypergraphSharedPtr hg = Block;
+			ostringstream out;
+
+			// Blocks may be decomposed concurrently, so the output of each block is written at once
+			HypertreeSharedPtr ht = decompK(hg, K, Root, out);
+			lock_guard<mutex> guard(out_lock);
+			cout << out.str();
+			return ht;
+		});
+		time(&end);
+
+		// The glued hypertree has the maximum width of the blocks
+		if (bMinWidth) {
+			if (HT == NULL && Budget != nullptr && Budget->exhausted())
+				cout << "Minimal width search stopped after " << difftime(end, start) << " sec (width: unknown)." << endl << endl;
+			else if (HT == NULL)
+				cout << "Hypertree of width at most " << K << " not found in " << difftime(end, start) << " sec." << endl << endl;
+			else
+				cout << "Minimal width search done in " << difftime(end, start) << " sec (width: " << HT->getHTreeWidth() << ")." << endl << endl;
+		}
+	}
+	else
+		HT = decompK(Reduced, K);
+
+	// Transform the hypertree into a hypertree of the input hypergraph
+	if (HT != NULL && bPreprocess)
+		HT = Prep.lift(HT);
 
 	// Check hypertree conditions
 	if (HT != NULL)
@@ -124,6 +210,52 @@ void usage(int argc, char **argv, int *K, bool *bDef)
 	for (i = 1; (i < argc) && (argv[i][0] == '-'); i++)
 		if (strcmp(argv[i], "-def") == 0)
 			*bDef = true;
+		else if (strcmp(argv[i], "-preprocess") == 0)
+			bPreprocess = true;
+		else if ((strcmp(argv[i], "-stats") == 0) && (i < argc - 1))
+			SearchStats::enable(argv[++i]);
+		else if ((strcmp(argv[i], "-trace") == 0) && (i < argc - 1))
+			cTraceFile = argv[++i];
+		else if ((strcmp(argv[i], "-order") == 0) && (i < argc - 1)) {
+			if (!parseEdgeOrder(argv[++i], Order)) {
+				cerr << "Unknown ordering \"" << argv[i] << "\" (use mcs, mindeg, minfill, or maxsize)." << endl;
+				exit(EXIT_FAILURE);
+			}
+		}
+		else if (strcmp(argv[i], "-blocks") == 0)
+			bBlocks = true;
+		else if (strcmp(argv[i], "-bicomp") == 0)
+			bBiconnected = true;
+		else if (strcmp(argv[i], "-min-width") == 0)
+			bMinWidth = true;
+		else if ((strcmp(argv[i], "-timeout") == 0) && (i < argc - 1)) {
+			iTimeLimit = atoi(argv[++i]);
+			if (iTimeLimit < 1) {
+				cerr << "Illegal time limit \"" << argv[i] << "\"." << endl;
+				exit(EXIT_FAILURE);
+			}
+		}
+		else if ((strcmp(argv[i], "-max-seps") == 0) && (i < argc - 1)) {
+			iMaxSeps = atoi(argv[++i]);
+			if (iMaxSeps < 1) {
+				cerr << "Illegal number of separators \"" << argv[i] << "\"." << endl;
+				exit(EXIT_FAILURE);
+			}
+		}
+		else if ((strcmp(argv[i], "-max-mem") == 0) && (i < argc - 1)) {
+			iMaxMem = atoi(argv[++i]);
+			if (iMaxMem < 1) {
+				cerr << "Illegal memory limit \"" << argv[i] << "\"." << endl;
+				exit(EXIT_FAILURE);
+			}
+		}
+		else if ((strcmp(argv[i], "-cache-mem") == 0) && (i < argc - 1)) {
+			iCacheMem = atoi(argv[++i]);
+			if (iCacheMem < 1) {
+				cerr << "Illegal cache memory limit \"" << argv[i] << "\"." << endl;
+				exit(EXIT_FAILURE);
+			}
+		}
 		else {
 			cerr << "Unknown argument \"" << argv[i] << "\"." << endl;
 			exit(EXIT_FAILURE);
@@ -148,8 +280,8 @@ void usage(int argc, char **argv, int *K, bool *bDef)
 		}
 
 		// Write usage error message
-		if ((!*bDef && (argc < 3)) || (*bDef && (argc < 4)) || (i < argc - 1)) {
-			cerr << "Usage: " << argv[0] << " [-def] <k> <filename>" << endl;
+		if ((*K == 0) || (i != argc - 1)) {
+			cerr << "Usage: " << argv[0] << " [-def] [-preprocess] [-order <heuristic>] [-blocks] [-bicomp] [-min-width] [-timeout <sec>] [-max-seps <n>] [-max-mem <MB>] [-cache-mem <MB>] [-stats <file>] [-trace <file>] <k> <filename>" << endl;
 			exit(EXIT_FAILURE);
 		}
 
@@ -171,25 +303,53 @@ void usage(int argc, char **argv, int *K, bool *bDef)
 }
 
 //BalSeparator
-HypertreeSharedPtr decompK(const HypergraphSharedPtr &HG, int iWidth)
+HypertreeSharedPtr decompK(const HypergraphSharedPtr &HG, int iWidth, const VertexSet &Root, ostream &Out)
 {
-	time_t start, end;
+	time_t start, end, total;
 	HypertreeSharedPtr HT;
-	BalKDecomp Decomp(HG, iWidth);
+	int k = bMinWidth ? 1 : iWidth;
+	BalKDecomp Decomp(HG, k);
 	BalKDecomp::init(HG, 0);
+	Decomp.setBudget(Budget);
+	BalKDecomp::setCacheLimit((size_t)iCacheMem << 20);
+	Decomp.setEdgeOrder(Order);
+	Decomp.setLog(Out);
+
+	// The cache of decomposed subgraphs is kept from one width to the next
+	time(&total);
+	for (; k <= iWidth; k++) {
+		Decomp.setWidth(k);
+
+		// Apply the decomposition algorithm
+		Out << "Building hypertree (det-" << k << "-decomp) ... " << endl;
+		time(&start);
+		HT = Decomp.buildRootedHypertree(Root);
+		time(&end);
+		if (HT == NULL && Budget != nullptr && Budget->exhausted()) {
+			Out << "Hypertree of width " << k << " unknown after " << difftime(end, start) << " sec." << endl;
+			Budget->writeStats(Out);
+			Out << endl;
+			break;
+		}
+		else if (HT == NULL)
+			Out << "Hypertree of width " << k << " not found in " << difftime(end, start) << " sec." << endl << endl;
+		else {
+			Out << "Building hypertree done in " << difftime(end, start) << " sec";
+			Out << " (hypertree-width: " << HT->getHTreeWidth() << ")." << endl << endl;
 
-	// Apply the decomposition algorithm
-	cout << "Building hypertree (det-" << iWidth << "-decomp) ... " << endl;
-	time(&start);
-	HT = Decomp.buildHypertree();
-	time(&end);
-	if (HT == NULL)
-		cout << "Hypertree of width " << iWidth << " not found in " << difftime(end, start) << " sec." << endl << endl;
-	else {
-		cout << "Building hypertree done in " << difftime(end, start) << " sec";
-		cout << " (hypertree-width: " << HT->getHTreeWidth() << ")." << endl << endl;
+			//HT->shrink(false);
+			break;
+		}
+	}
 
-		//HT->shrink(false);
+	// With blocks, the width of the whole hypergraph is written once the blocks are glued
+	if (bMinWidth && !bBlocks && !bBiconnected) {
+		if (HT == NULL && Budget != nullptr && Budget->exhausted())
+			Out << "Minimal width search stopped after " << difftime(end, total) << " sec (width: unknown, at least " << k << ")." << endl << endl;
+		else if (HT == NULL)
+			Out << "Hypertree of width at most " << iWidth << " not found in " << difftime(end, total) << " sec." << endl << endl;
+		else
+			Out << "Minimal width search done in " << difftime(end, total) << " sec (width: " << k << ")." << endl << endl;
 	}
 
 	return HT;
@@ -0,0 +1,324 @@
+// portfolio-k-decomp V2.0
+//
+// Races several configurations of det-k-decomp, localbip-k-decomp, and
+// balsep-k-decomp (ordering of the hyperedges and random seed) on separate
+// threads and keeps the first decomposition found.
+//
+// Note: This program is a prototype implementation and does in no sense
+// claim to be the most efficient way of implementing a portfolio of
+// decomposition algorithms.
+
+
+#define _CRT_SECURE_NO_DEPRECATE
+
+#include <cstdlib>
+#include <cstdio>
+#include <iostream>
+#include <ctime>
+#include <list>
+#include <cstring>
+
+using namespace std;
+
+#include "../Parser.h"
+#include "../Hypergraph.h"
+#include "../Hypertree.h"
+#include "../Vertex.h"
+#include "../Hyperedge.h"
+#include "../Globals.h"
+#include "../SearchBudget.h"
+#include "../SearchStats.h"
+#include "../SearchTrace.h"
+#include "../Preprocessor.h"
+#include "../PortfolioDecomp.h"
+
+void usage(int, char **, int *, bool *);
+HypertreeSharedPtr decompK(HypergraphSharedPtr &, int, const VertexSet & = VertexSet());
+
+
+char *cInpFile, *cOutFile;
+
+// File the search tree is traced to (nullptr if it is not traced)
+char *cTraceFile = nullptr;
+
+// Configurations raced against each other (one thread per configuration)
+vector<PortfolioDecomp::Config> Configs;
+
+// Number of configurations taken from the default portfolio if no configuration is given
+int iNbrOfThreads = 4;
+
+// Default portfolio in the order in which configurations are taken
+const char *cDefaultConfigs[] = { "det:mcs:1", "localbip:mcs:1", "det:minfill", "balsep:mcs:1",
+	"det:mindeg", "det:mcs:2", "localbip:minfill", "det:maxsize", "det:mcs:3", "localbip:mcs:2" };
+
+// Tries the widths 1, ..., k in turn and stops at the first one that admits a decomposition
+bool bMinWidth = false;
+
+// Reduces the hypergraph before the decomposition and lifts the hypertree afterwards
+bool bPreprocess = false;
+
+// Budget of the search (0 if unlimited): wall-clock time in seconds, number of separators, memory in MB
+int iTimeLimit = 0, iMaxSeps = 0, iMaxMem = 0;
+
+// Memory of the caches of decomposable and undecomposable components in MB (0 if unlimited)
+int iCacheMem = 0;
+
+// Budget created from the limits (nullptr if the search is unlimited)
+SearchBudgetSharedPtr Budget;
+
+
+
+int main(int argc, char **argv)
+{
+	int iRandomInit, K = 0;
+	bool bDef;
+	time_t start, end;
+	HypergraphSharedPtr HG = make_shared<Hypergraph>();
+	Parser *P;
+	HypertreeSharedPtr HT;
+	Preprocessor Prep;
+
+	cout << "*** portfolio-k-decomp (version 2.0) ***" << endl << endl;
+
+	// Check command line arguments and initialize random number generator
+	usage(argc, argv, &K, &bDef);
+
+	// Start the budget before parsing such that the time limit covers the whole run
+	if (iTimeLimit > 0 || iMaxSeps > 0 || iMaxMem > 0)
+		Budget = make_shared<SearchBudget>(iTimeLimit, iMaxSeps, iMaxMem);
+	//srand(200);
+	srand((unsigned int)time(NULL));
+	iRandomInit = random_range(999, 9999);
+	for (int i = 0; i < iRandomInit; i++) rand();
+
+	// Create parser object
+	if ((P = new Parser(bDef)) == NULL)
+		writeErrorMsg("Error assigning memory.", "main");
+
+	// Parse file
+	cout << "Parsing input file \"" << cInpFile << "\" ... " << endl;
+	time(&start);
+	P->parseFile(cInpFile);
+	time(&end);
+	cout << "Parsing input file done in " << difftime(end, start) << " sec";
+	cout << " (" << P->getNbrOfAtoms() << " atoms, " << P->getNbrOfVars() << " variables)." << endl << endl;
+
+	// Build hypergraph
+	cout << "Building hypergraph ... " << endl;
+	time(&start);
+	HG->buildHypergraph(*P);
+	if (!HG->isConnected())
+		cerr << "Warning: Hypergraph is not connected." << endl;
+	time(&end);
+	cout << "Building hypergraph done in " << difftime(end, start) << " sec." << endl << endl;
+	delete P;
+
+	// Start the trace once the names of the hyperedges and vertices are known
+	if (cTraceFile != nullptr)
+		SearchTrace::enable(cTraceFile, HG);
+
+	// Reduce the hypergraph
+	HypergraphSharedPtr Reduced = HG;
+	if (bPreprocess) {
+		cout << "Preprocessing hypergraph ... " << endl;
+		time(&start);
+		Reduced = Prep.reduce(HG);
+		time(&end);
+		cout << "Preprocessing hypergraph done in " << difftime(end, start) << " sec";
+		cout << " (" << Reduced->getNbrOfEdges() << " edges, " << Reduced->getNbrOfVertices() << " vertices)." << endl;
+		Prep.writeStats(cout);
+		cout << endl;
+	}
+
+	HT = decompK(Reduced, K);
+
+	// Transform the hypertree into a hypertree of the input hypergraph
+	if (HT != NULL && bPreprocess)
+		HT = Prep.lift(HT);
+
+	// Check hypertree conditions
+	if (HT != NULL)
+	{
+		cout << "Checking hypertree conditions ... " << endl;
+		time(&start);
+		HT->verify();
+		time(&end);
+		cout << "Checking hypertree conditions done in " << difftime(end, start) << " sec." << endl << endl;
+		HT->outputToGML(cOutFile);
+		cout << "GML output written to: " << cOutFile << endl << endl;
+	}
+
+	return EXIT_SUCCESS;
+}
+
+
+void usage(int argc, char **argv, int *K, bool *bDef)
+{
+	int i, j, k;
+	*bDef = false;
+
+	// Check arguments
+	for (i = 1; (i < argc) && (argv[i][0] == '-'); i++)
+		if (strcmp(argv[i], "-def") == 0)
+			*bDef = true;
+		else if (strcmp(argv[i], "-preprocess") == 0)
+			bPreprocess = true;
+		else if ((strcmp(argv[i], "-stats") == 0) && (i < argc - 1))
+			SearchStats::enable(argv[++i]);
+		else if ((strcmp(argv[i], "-trace") == 0) && (i < argc - 1))
+			cTraceFile = argv[++i];
+		else if ((strcmp(argv[i], "-config") == 0) && (i < argc - 1)) {
+			PortfolioDecomp::Config config;
+			if (!PortfolioDecomp::parseConfig(argv[++i], config)) {
+				cerr << "Illegal configuration \"" << argv[i] << "\" (use <det|localbip|balsep>[:<ordering>[:<seed>]])." << endl;
+				exit(EXIT_FAILURE);
+			}
+			Configs.push_back(config);
+		}
+		else if (strcmp(argv[i], "-min-width") == 0)
+			bMinWidth = true;
+		else if ((strcmp(argv[i], "-threads") == 0) && (i < argc - 1)) {
+			iNbrOfThreads = atoi(argv[++i]);
+			if (iNbrOfThreads < 1 || iNbrOfThreads > (int)(sizeof(cDefaultConfigs) / sizeof(cDefaultConfigs[0]))) {
+				cerr << "Illegal number of threads \"" << argv[i] << "\"." << endl;
+				exit(EXIT_FAILURE);
+			}
+		}
+		else if ((strcmp(argv[i], "-timeout") == 0) && (i < argc - 1)) {
+			iTimeLimit = atoi(argv[++i]);
+			if (iTimeLimit < 1) {
+				cerr << "Illegal time limit \"" << argv[i] << "\"." << endl;
+				exit(EXIT_FAILURE);
+			}
+		}
+		else if ((strcmp(argv[i], "-max-seps") == 0) && (i < argc - 1)) {
+			iMaxSeps = atoi(argv[++i]);
+			if (iMaxSeps < 1) {
+				cerr << "Illegal number of separators \"" << argv[i] << "\"." << endl;
+				exit(EXIT_FAILURE);
+			}
+		}
+		else if ((strcmp(argv[i], "-max-mem") == 0) && (i < argc - 1)) {
+			iMaxMem = atoi(argv[++i]);
+			if (iMaxMem < 1) {
+				cerr << "Illegal memory limit \"" << argv[i] << "\"." << endl;
+				exit(EXIT_FAILURE);
+			}
+		}
+		else if ((strcmp(argv[i], "-cache-mem") == 0) && (i < argc - 1)) {
+			iCacheMem = atoi(argv[++i]);
+			if (iCacheMem < 1) {
+				cerr << "Illegal cache memory limit \"" << argv[i] << "\"." << endl;
+				exit(EXIT_FAILURE);
+			}
+		}
+		else {
+			cerr << "Unknown argument \"" << argv[i] << "\"." << endl;
+			exit(EXIT_FAILURE);
+		}
+
+	if (i < argc - 1) {
+		for (j = 0; argv[i][j] == '0'; j++);
+		for (k = 0; (k < 6) && (argv[i][j + k] != '\0'); k++)
+			if (!((argv[i][j + k] >= '0') && (argv[i][j + k] <= '9')))
+				break;
+		if (argv[i][j + k] == '\0') {
+			*K = atoi(argv[i++]);
+			if (*K < 1) {
+				cerr << "Illegal argument k = 0." << endl;
+				exit(EXIT_FAILURE);
+			}
+		}
+		else {
+			cerr << "Illegal argument k = " << argv[i] << "." << endl;
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	// Write usage error message
+	if ((*K == 0) || (i != argc - 1)) {
+		cerr << "Usage: " << argv[0] << " [-def] [-preprocess] [-config <alg>[:<ordering>[:<seed>]]]... [-threads <n>] [-min-width] [-timeout <sec>] [-max-seps <n>] [-max-mem <MB>] [-cache-mem <MB>] [-stats <file>] [-trace <file>] <k> <filename>" << endl;
+		exit(EXIT_FAILURE);
+	}
+
+	cInpFile = argv[i];
+
+	// Construct output-file name
+	for (i = (int)strlen(cInpFile) - 1; i > 0; i--)
+		if (cInpFile[i] == '.')
+			break;
+	if (i > 0)
+		cInpFile[i] = '\0';
+	cOutFile = new char[strlen(cInpFile) + 5];
+	if (cOutFile == NULL)
+		writeErrorMsg("Error assigning memory.", "usage");
+	strcpy(cOutFile, cInpFile);
+	strcat(cOutFile, ".gml");
+	if (i > 0)
+		cInpFile[i] = '.';
+}
+
+HypertreeSharedPtr decompK(HypergraphSharedPtr &HG, int iWidth, const VertexSet &Root)
+{
+	time_t start, end, total;
+	HypertreeSharedPtr HT;
+	int k = bMinWidth ? 1 : iWidth;
+	PortfolioDecomp Decomp(HG, k);
+	Decomp.setBudget(Budget);
+	Decomp.setCacheLimit((size_t)iCacheMem << 20);
+
+	if (Configs.empty())
+		for (int i = 0; i < iNbrOfThreads; i++) {
+			PortfolioDecomp::Config config;
+			PortfolioDecomp::parseConfig(cDefaultConfigs[i], config);
+			Configs.push_back(config);
+		}
+
+	cout << "Racing " << Configs.size() << " configurations:";
+	for (auto &config : Configs) {
+		Decomp.addConfig(config);
+		cout << " " << PortfolioDecomp::getConfigName(config);
+	}
+	cout << endl << endl;
+
+	// The caches of all configurations are kept from one width to the next
+	time(&total);
+	for (; k <= iWidth; k++) {
+		Decomp.setWidth(k);
+
+		// Apply the decomposition algorithms
+		cout << "Building hypertree (portfolio-" << k << "-decomp) ... " << endl;
+		time(&start);
+		HT = Decomp.buildRootedHypertree(Root);
+		time(&end);
+		if (HT == NULL && Budget != nullptr && Budget->exhausted()) {
+			cout << "Hypertree of width " << k << " unknown after " << difftime(end, start) << " sec." << endl;
+			Budget->writeStats(cout);
+			cout << endl;
+			break;
+		}
+		else if (HT == NULL)
+			cout << "Hypertree of width " << k << " not found in " << difftime(end, start) << " sec." << endl << endl;
+		else {
+			cout << "Building hypertree done in " << difftime(end, start) << " sec";
+			cout << " (width: " << HT->getHTreeWidth() << ", found by ";
+			cout << PortfolioDecomp::getConfigName(Decomp.getConfig(Decomp.getWinner())) << ")." << endl << endl;
+
+			// Hypertrees of balsep-k-decomp are not shrunk (as in balsep-k-decomp itself)
+			if (Decomp.getConfig(Decomp.getWinner()).Alg != PortfolioDecomp::Algorithm::BalSep)
+				HT->shrink(false);
+			break;
+		}
+	}
+
+	if (bMinWidth) {
+		if (HT == NULL && Budget != nullptr && Budget->exhausted())
+			cout << "Minimal width search stopped after " << difftime(end, total) << " sec (width: unknown, at least " << k << ")." << endl << endl;
+		else if (HT == NULL)
+			cout << "Hypertree of width at most " << iWidth << " not found in " << difftime(end, total) << " sec." << endl << endl;
+		else
+			cout << "Minimal width search done in " << difftime(end, total) << " sec (width: " << k << ")." << endl << endl;
+	}
+
+	return HT;
+}
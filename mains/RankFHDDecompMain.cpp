@@ -53,6 +53,10 @@ using namespace std;
 #include "../Vertex.h"
 #include "../Hyperedge.h"
 #include "../Globals.h"
+#include "../SearchBudget.h"
+#include "../SearchStats.h"
+#include "../SearchTrace.h"
+#include "../Preprocessor.h"
 #include "../Subedges.h"
 #include "../RankFHDecomp.h"
 
@@ -62,6 +66,31 @@ HypertreeSharedPtr decompK(const HypergraphSharedPtr &, double);
 
 char *cInpFile, *cOutFile;
 
+// File the search tree is traced to (nullptr if it is not traced)
+char *cTraceFile = nullptr;
+
+// Number of threads used to decompose sibling components concurrently (1 if the search is sequential)
+int iNbrOfThreads = 1;
+
+// Number of recursion levels at which sibling components are decomposed concurrently
+int iCompDepth = 0;
+
+// Reduces the hypergraph before the decomposition and lifts the hypertree afterwards
+// (vertices occurring in a single edge are kept since stripping them may increase the fractional width)
+bool bPreprocess = false;
+
+// Heuristic for ordering the hyperedges before the search
+EdgeOrder Order = EdgeOrder::MCS;
+
+// Budget of the search (0 if unlimited): wall-clock time in seconds, number of separators, memory in MB
+int iTimeLimit = 0, iMaxSeps = 0, iMaxMem = 0;
+
+// Memory of the caches of decomposable and undecomposable components in MB (0 if unlimited)
+int iCacheMem = 0;
+
+// Budget created from the limits (nullptr if the search is unlimited)
+SearchBudgetSharedPtr Budget;
+
 
 
 int main(int argc, char **argv)
@@ -73,11 +102,16 @@ int main(int argc, char **argv)
 	HypergraphSharedPtr HG = make_shared<Hypergraph>();
 	Parser *P;
 	HypertreeSharedPtr HT{ nullptr };
+	Preprocessor Prep(true, true, false);
 
 	cout << "*** rankfhd-k-decomp (version 1.0) ***" << endl << endl;
 
 	// Check command line arguments and initialize random number generator
 	usage(argc, argv, &K, &bDef);
+
+	// Start the budget before parsing such that the time limit covers the whole run
+	if (iTimeLimit > 0 || iMaxSeps > 0 || iMaxMem > 0)
+		Budget = make_shared<SearchBudget>(iTimeLimit, iMaxSeps, iMaxMem);
 	int seed = (unsigned int)time(NULL);
 	//int seed = 500;
 	srand(seed);
@@ -106,7 +140,28 @@ int main(int argc, char **argv)
 	cout << "Building hypergraph done in " << difftime(end, start) << " sec." << endl << endl;
 	delete P;
 
-	HT = decompK(HG, K);
+	// Start the trace once the names of the hyperedges and vertices are known
+	if (cTraceFile != nullptr)
+		SearchTrace::enable(cTraceFile, HG);
+
+	// Reduce the hypergraph
+	HypergraphSharedPtr Reduced = HG;
+	if (bPreprocess) {
+		cout << "Preprocessing hypergraph ... " << endl;
+		time(&start);
+		Reduced = Prep.reduce(HG);
+		time(&end);
+		cout << "Preprocessing hypergraph done in " << difftime(end, start) << " sec";
+		cout << " (" << Reduced->getNbrOfEdges() << " edges, " << Reduced->getNbrOfVertices() << " vertices)." << endl;
+		Prep.writeStats(cout);
+		cout << endl;
+	}
+
+	HT = decompK(Reduced, K);
+
+	// Transform the hypertree into a hypertree of the input hypergraph
+	if (HT != NULL && bPreprocess)
+		HT = Prep.lift(HT);
 
 	// Check hypertree conditions
 	if (HT != NULL)
@@ -134,6 +189,60 @@ void usage(int argc, char **argv, double *K, bool *bDef)
 	for (i = 1; (i < argc) && (argv[i][0] == '-'); i++)
 		if (strcmp(argv[i], "-def") == 0)
 			*bDef = true;
+		else if (strcmp(argv[i], "-preprocess") == 0)
+			bPreprocess = true;
+		else if ((strcmp(argv[i], "-stats") == 0) && (i < argc - 1))
+			SearchStats::enable(argv[++i]);
+		else if ((strcmp(argv[i], "-trace") == 0) && (i < argc - 1))
+			cTraceFile = argv[++i];
+		else if ((strcmp(argv[i], "-order") == 0) && (i < argc - 1)) {
+			if (!parseEdgeOrder(argv[++i], Order)) {
+				cerr << "Unknown ordering \"" << argv[i] << "\" (use mcs, mindeg, minfill, or maxsize)." << endl;
+				exit(EXIT_FAILURE);
+			}
+		}
+		else if ((strcmp(argv[i], "-threads") == 0) && (i < argc - 1)) {
+			iNbrOfThreads = atoi(argv[++i]);
+			if (iNbrOfThreads < 1) {
+				cerr << "Illegal number of threads \"" << argv[i] << "\"." << endl;
+				exit(EXIT_FAILURE);
+			}
+		}
+		else if ((strcmp(argv[i], "-parcomp") == 0) && (i < argc - 1)) {
+			iCompDepth = atoi(argv[++i]);
+			if (iCompDepth < 0) {
+				cerr << "Illegal recursion depth \"" << argv[i] << "\"." << endl;
+				exit(EXIT_FAILURE);
+			}
+		}
+		else if ((strcmp(argv[i], "-timeout") == 0) && (i < argc - 1)) {
+			iTimeLimit = atoi(argv[++i]);
+			if (iTimeLimit < 1) {
+				cerr << "Illegal time limit \"" << argv[i] << "\"." << endl;
+				exit(EXIT_FAILURE);
+			}
+		}
+		else if ((strcmp(argv[i], "-max-seps") == 0) && (i < argc - 1)) {
+			iMaxSeps = atoi(argv[++i]);
+			if (iMaxSeps < 1) {
+				cerr << "Illegal number of separators \"" << argv[i] << "\"." << endl;
+				exit(EXIT_FAILURE);
+			}
+		}
+		else if ((strcmp(argv[i], "-max-mem") == 0) && (i < argc - 1)) {
+			iMaxMem = atoi(argv[++i]);
+			if (iMaxMem < 1) {
+				cerr << "Illegal memory limit \"" << argv[i] << "\"." << endl;
+				exit(EXIT_FAILURE);
+			}
+		}
+		else if ((strcmp(argv[i], "-cache-mem") == 0) && (i < argc - 1)) {
+			iCacheMem = atoi(argv[++i]);
+			if (iCacheMem < 1) {
+				cerr << "Illegal cache memory limit \"" << argv[i] << "\"." << endl;
+				exit(EXIT_FAILURE);
+			}
+		}
 		else {
 			cerr << "Unknown argument \"" << argv[i] << "\"." << endl;
 			exit(EXIT_FAILURE);
@@ -158,8 +267,8 @@ void usage(int argc, char **argv, double *K, bool *bDef)
 		}
 
 		// Write usage error message
-		if ((!*bDef && (argc < 3)) || (*bDef && (argc < 4)) || (i < argc - 1)) {
-			cerr << "Usage: " << argv[0] << " [-def] <k> <filename>" << endl;
+		if ((*K == 0) || (i != argc - 1)) {
+			cerr << "Usage: " << argv[0] << " [-def] [-preprocess] [-order <heuristic>] [-threads <n>] [-parcomp <d>] [-timeout <sec>] [-max-seps <n>] [-max-mem <MB>] [-cache-mem <MB>] [-stats <file>] [-trace <file>] <k> <filename>" << endl;
 			exit(EXIT_FAILURE);
 		}
 
@@ -186,6 +295,10 @@ HypertreeSharedPtr decompK(const HypergraphSharedPtr &HG, double iWidth)
 	time_t start, end;
 	HypertreeSharedPtr HT;
 	RankFHDecomp Decomp(HG, iWidth);
+	Decomp.setParallel(iNbrOfThreads, iCompDepth);
+	Decomp.setBudget(Budget);
+	Decomp.setCacheLimit((size_t)iCacheMem << 20);
+	Decomp.setEdgeOrder(Order);
 
 
 	// Apply the decomposition algorithm
@@ -193,7 +306,12 @@ HypertreeSharedPtr decompK(const HypergraphSharedPtr &HG, double iWidth)
 	time(&start);
 	HT = Decomp.buildHypertree();
 	time(&end);
-	if (HT == NULL)
+	if (HT == NULL && Budget != nullptr && Budget->exhausted()) {
+		cout << "Hypertree of width " << iWidth << " unknown after " << difftime(end, start) << " sec." << endl;
+		Budget->writeStats(cout);
+		cout << endl;
+	}
+	else if (HT == NULL)
 		cout << "Hypertree of width " << iWidth << " not found in " << difftime(end, start) << " sec." << endl << endl;
 	else {
 		cout << "Building hypertree done in " << difftime(end, start) << " sec";
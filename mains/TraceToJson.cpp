@@ -0,0 +1,50 @@
+// trace2json V2.0
+//
+// Converts a search trace written with the option -trace of the decomposition
+// programs into the trace-event JSON format, which can be loaded into
+// chrome://tracing or the Perfetto UI to inspect the search tree.
+//
+// Note: This program is a prototype implementation and does in no sense
+// claim to be the most efficient way of converting search traces.
+
+
+#define _CRT_SECURE_NO_DEPRECATE
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+
+using namespace std;
+
+#include "../SearchTrace.h"
+
+
+int main(int argc, char **argv)
+{
+	if (argc < 2 || argc > 3) {
+		cerr << "Usage: " << argv[0] << " <trace> [<json>]" << endl;
+		return EXIT_FAILURE;
+	}
+
+	ifstream in(argv[1], ios::binary);
+	if (!in) {
+		cerr << "Cannot read trace \"" << argv[1] << "\"." << endl;
+		return EXIT_FAILURE;
+	}
+
+	ofstream file;
+	if (argc == 3) {
+		file.open(argv[2]);
+		if (!file) {
+			cerr << "Cannot write \"" << argv[2] << "\"." << endl;
+			return EXIT_FAILURE;
+		}
+	}
+
+	if (!SearchTrace::convertToJson(in, argc == 3 ? file : cout)) {
+		cerr << "\"" << argv[1] << "\" is no search trace or is truncated." << endl;
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}